@@ -0,0 +1,324 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+   Permission is hereby granted, free of charge, to any person obtaining
+   a copy of this software and associated documentation files (the
+   "Software"), to deal in the Software without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Software, and to
+   permit persons to whom the Software is furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be
+   included in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+   NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+   LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+   OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/all.hpp"
+
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+#include "silkit/experimental/participant/ParticipantExtensions.hpp"
+
+using namespace SilKit::Services::Orchestration;
+using namespace SilKit::Services::PubSub;
+using namespace std::chrono_literals;
+
+using Clock = std::chrono::steady_clock;
+
+std::chrono::milliseconds stepSize = 1ms;
+
+void PrintUsage(const std::string& executableName)
+{
+    std::cout
+        << "Usage:" << std::endl
+        << executableName << " [options]" << std::endl
+        << "If no arguments are given, default values will be used." << std::endl
+        << "\t--help\tshow this message." << std::endl
+        << "\t--registry-uri\tThe URI of the registry to start. Default: silkit://localhost:8500" << std::endl
+        << "\t--message-size\tSets the size of the bulk messages to BYTES. Default: 65536" << std::endl
+        << "\t--message-count\tSets the number of bulk messages sent in each simulation step to NUM. Default: 20"
+        << std::endl
+        << "\t--simulation-duration\tSets the simulation duration (virtual time) to SECONDS. Default: 1s" << std::endl
+        << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: empty"
+        << std::endl;
+}
+
+struct BenchmarkConfig
+{
+    std::chrono::seconds simulationDuration = 1s;
+    uint32_t messageCount = 20;
+    uint32_t messageSizeInBytes = 64 * 1024;
+    std::string registryUri = "silkit://localhost:8500";
+    std::string silKitConfigPath = "";
+};
+
+bool Parse(int argc, char** argv, BenchmarkConfig& config)
+{
+    // skip argv[0] and collect all arguments
+    std::vector<std::string> args;
+    std::copy((argv + 1), (argv + argc), std::back_inserter(args));
+
+    auto asNum = [](const auto& str) {
+        return static_cast<uint32_t>(std::stoul(str));
+    };
+    auto asStr = [](auto& a) {
+        return std::string{a};
+    };
+
+    if (std::find(args.begin(), args.end(), "--help") != args.end())
+    {
+        PrintUsage(argv[0]);
+        return false;
+    }
+
+    // Consume a named option and return its argument, or throw if an invalid argument is given.
+    auto getArg = [&args](const auto& name) {
+        auto argIt = std::find(args.begin(), args.end(), name);
+        if (argIt == args.end())
+        {
+            return std::string{}; //the argument is not even mentioned
+        }
+        auto valIt = argIt + 1;
+        if (valIt == args.end())
+        {
+            throw std::runtime_error{std::string{"Option \""} + name + "\" is missing an argument!"};
+        }
+        // remove consumed args
+        auto result = *valIt;
+        args.erase(valIt);
+        args.erase(argIt);
+        return result;
+    };
+    auto parseOptional = [&getArg](const auto& argName, auto& outputValue, auto conversionFunc) {
+        auto arg = getArg(argName);
+        if (!arg.empty())
+        {
+            using OutputT = std::remove_reference_t<decltype(outputValue)>;
+            outputValue = OutputT{conversionFunc(arg)};
+        }
+    };
+
+    try
+    {
+        parseOptional("--registry-uri", config.registryUri, asStr);
+        parseOptional("--message-size", config.messageSizeInBytes, asNum);
+        parseOptional("--message-count", config.messageCount, asNum);
+        parseOptional("--simulation-duration", config.simulationDuration, asNum);
+        parseOptional("--configuration", config.silKitConfigPath, asStr);
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << "Error parsing arguments: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (!args.empty())
+    {
+        std::cout << "Error: unknown argument \"" << args.front() << "\"" << std::endl;
+        PrintUsage(argv[0]);
+        return false;
+    }
+
+    if (config.simulationDuration < 1s)
+    {
+        std::cout << "Invalid argument: The simulation duration (virtual time) must be at least 1 second." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void PrintParameters(const BenchmarkConfig& benchmark)
+{
+#ifndef NDEBUG
+    std::cout << "WARNING: The control latency demo is executed in a DEBUG build configuration." << std::endl
+              << "For more reliable timings, please use a RELEASE build configuration" << std::endl
+              << "of the SIL Kit library and the control latency demo." << std::endl;
+    std::this_thread::sleep_for(2s);
+#endif
+
+    std::cout << std::endl
+              << "This demo measures how long the time synchronization is delayed by bulk data." << std::endl
+              << "The participant 'Sender' publishes <M> messages of <B> bytes per simulation step" << std::endl
+              << "to the participant 'Receiver'. The delay is the time between the end of a simulation step" << std::endl
+              << "of the sender and the start of the next simulation step of the receiver." << std::endl
+              << std::endl
+              << std::left << std::setw(38) << "- Simulation duration (virtual time): "
+              << benchmark.simulationDuration.count() << "s" << std::endl
+              << std::left << std::setw(38) << "- Messages per simulation step (1ms): " << benchmark.messageCount
+              << std::endl
+              << std::left << std::setw(38) << "- Message size (bytes): " << benchmark.messageSizeInBytes << std::endl
+              << std::left << std::setw(38) << "- Registry URI: " << benchmark.registryUri << std::endl
+              << std::left << std::setw(38) << "- Configuration: " << benchmark.silKitConfigPath << std::endl
+              << std::endl;
+}
+
+auto StepIndex(std::chrono::nanoseconds now) -> std::size_t
+{
+    return static_cast<std::size_t>(now / stepSize);
+}
+
+void RecordStep(std::vector<Clock::time_point>& timestamps, std::chrono::nanoseconds now)
+{
+    // steps executed while the simulation is stopping are not recorded
+    const auto index = StepIndex(now);
+    if (index < timestamps.size())
+    {
+        timestamps[index] = Clock::now();
+    }
+}
+
+void SenderThread(std::shared_ptr<SilKit::Config::IParticipantConfiguration> config,
+                  const BenchmarkConfig& benchmark, std::vector<Clock::time_point>& stepEnds)
+{
+    auto participant = SilKit::CreateParticipant(config, "Sender", benchmark.registryUri);
+    auto* lifecycleService = participant->CreateLifecycleService({OperationMode::Coordinated});
+    auto* timeSyncService = lifecycleService->CreateTimeSyncService();
+    auto* publisher = participant->CreateDataPublisher("BulkPublisher", {"Bulk", {}}, 0);
+
+    timeSyncService->SetSimulationStepHandler(
+        [&](std::chrono::nanoseconds now, std::chrono::nanoseconds /*duration*/) {
+            if (now >= benchmark.simulationDuration)
+            {
+                lifecycleService->Stop("Simulation done");
+            }
+
+            for (uint32_t i = 0; i < benchmark.messageCount; i++)
+            {
+                publisher->Publish(std::vector<uint8_t>(benchmark.messageSizeInBytes, '*'));
+            }
+
+            // the NextSimTask of the following step is sent right after the handler returns
+            RecordStep(stepEnds, now);
+        },
+        stepSize);
+
+    lifecycleService->StartLifecycle().get();
+}
+
+void ReceiverThread(std::shared_ptr<SilKit::Config::IParticipantConfiguration> config,
+                    const BenchmarkConfig& benchmark, std::vector<Clock::time_point>& stepStarts)
+{
+    auto participant = SilKit::CreateParticipant(config, "Receiver", benchmark.registryUri);
+    auto* lifecycleService = participant->CreateLifecycleService({OperationMode::Coordinated});
+    auto* timeSyncService = lifecycleService->CreateTimeSyncService();
+    participant->CreateDataSubscriber("BulkSubscriber", {"Bulk", {}}, [](auto*, const auto&) {});
+
+    timeSyncService->SetSimulationStepHandler(
+        [&](std::chrono::nanoseconds now, std::chrono::nanoseconds /*duration*/) {
+            RecordStep(stepStarts, now);
+        },
+        stepSize);
+
+    lifecycleService->StartLifecycle().get();
+}
+
+int main(int argc, char** argv)
+{
+    std::cout << std::fixed << std::setprecision(1);
+    BenchmarkConfig benchmark;
+    if (!Parse(argc, argv, benchmark))
+    {
+        return -1;
+    }
+
+    PrintParameters(benchmark);
+
+    try
+    {
+        std::shared_ptr<SilKit::Config::IParticipantConfiguration> config;
+        if (benchmark.silKitConfigPath == "")
+        {
+            config = SilKit::Config::ParticipantConfigurationFromString("{}");
+        }
+        else
+        {
+            config = SilKit::Config::ParticipantConfigurationFromFile(benchmark.silKitConfigPath);
+        }
+
+        auto registry = SilKit::Vendor::Vector::CreateSilKitRegistry(config);
+        registry->StartListening(benchmark.registryUri);
+
+        // one slot for each simulation step, including the step in which the simulation is stopped
+        const auto numSteps = StepIndex(benchmark.simulationDuration) + 1;
+        std::vector<Clock::time_point> senderStepEnds(numSteps);
+        std::vector<Clock::time_point> receiverStepStarts(numSteps);
+
+        std::thread sender{&SenderThread, config, std::cref(benchmark), std::ref(senderStepEnds)};
+        std::thread receiver{&ReceiverThread, config, std::cref(benchmark), std::ref(receiverStepStarts)};
+
+        auto systemControllerParticipant = SilKit::CreateParticipant(config, "SystemController", benchmark.registryUri);
+        auto systemController =
+            SilKit::Experimental::Participant::CreateSystemController(systemControllerParticipant.get());
+        systemController->SetWorkflowConfiguration({{"Sender", "Receiver", "SystemController"}});
+        auto lifecycleService = systemControllerParticipant->CreateLifecycleService({OperationMode::Coordinated});
+        lifecycleService->StartLifecycle().get();
+
+        sender.join();
+        receiver.join();
+
+        std::vector<double> delaysInMicroseconds;
+        for (std::size_t step = 0; step + 1 < numSteps; step++)
+        {
+            const auto senderStepEnd = senderStepEnds[step];
+            const auto receiverStepStart = receiverStepStarts[step + 1];
+            if (senderStepEnd == Clock::time_point{} || receiverStepStart == Clock::time_point{})
+            {
+                continue;
+            }
+            const auto delay = std::max(receiverStepStart - senderStepEnd, Clock::duration{0});
+            delaysInMicroseconds.push_back(std::chrono::duration<double, std::micro>(delay).count());
+        }
+
+        if (delaysInMicroseconds.empty())
+        {
+            std::cerr << "No simulation steps were measured." << std::endl;
+            return -3;
+        }
+
+        std::sort(delaysInMicroseconds.begin(), delaysInMicroseconds.end());
+        const auto percentile = [&delaysInMicroseconds](double p) {
+            return delaysInMicroseconds[static_cast<std::size_t>(p * (delaysInMicroseconds.size() - 1))];
+        };
+        const auto mean = std::accumulate(delaysInMicroseconds.begin(), delaysInMicroseconds.end(), 0.0)
+                          / delaysInMicroseconds.size();
+
+        std::cout << "Delay of the next simulation step of the receiver:" << std::endl
+                  << std::endl
+                  << std::left << std::setw(38) << "- Measured simulation steps: " << delaysInMicroseconds.size()
+                  << std::endl
+                  << std::left << std::setw(38) << "- Mean: " << mean << " us" << std::endl
+                  << std::left << std::setw(38) << "- Median: " << percentile(0.5) << " us" << std::endl
+                  << std::left << std::setw(38) << "- 99th percentile: " << percentile(0.99) << " us" << std::endl
+                  << std::left << std::setw(38) << "- Maximum: " << delaysInMicroseconds.back() << " us" << std::endl
+                  << std::endl;
+    }
+    catch (const SilKit::ConfigurationError& error)
+    {
+        std::cerr << "Invalid configuration: " << error.what() << std::endl;
+        return -2;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "Something went wrong: " << error.what() << std::endl;
+        return -3;
+    }
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+#Usage: ./benchmark.sh <path/to/epoll/SilKitDemoBenchmark> <path/to/io_uring/SilKitDemoBenchmark>
+echo 'Cleanup'
+rm -f ./result-io-backend-epoll.csv ./result-io-backend-epoll-tcp.csv
+rm -f ./result-io-backend-io-uring.csv ./result-io-backend-io-uring-tcp.csv
+rm -f ./result-io-backend-diff.csv ./result-io-backend-diff-tcp.csv
+rm -f ./result-io-backend.pdf
+
+EXE_EPOLL=$1
+EXE_IO_URING=$2
+TCPCONFIG=../msg-size-scaling/SilKitConfig_DemoBenchmark_DomainSockets_Off.yaml
+
+echo 'Run benchmarks with epoll and domain sockets ...'
+./run-bench-io-backend.sh ${EXE_EPOLL} ./result-io-backend-epoll.csv
+
+echo 'Run benchmarks with io_uring and domain sockets ...'
+./run-bench-io-backend.sh ${EXE_IO_URING} ./result-io-backend-io-uring.csv
+
+echo 'Run benchmarks with epoll and TCP ...'
+./run-bench-io-backend.sh ${EXE_EPOLL} ./result-io-backend-epoll-tcp.csv ${TCPCONFIG}
+
+echo 'Run benchmarks with io_uring and TCP ...'
+./run-bench-io-backend.sh ${EXE_IO_URING} ./result-io-backend-io-uring-tcp.csv ${TCPCONFIG}
+
+if python -c 'import pandas' 2> /dev/null; then
+    echo 'Compute the average change ...'
+    python ../performance-diff/diff.py ./result-io-backend-epoll.csv ./result-io-backend-io-uring.csv ./result-io-backend-diff.csv
+    python ../performance-diff/diff.py ./result-io-backend-epoll-tcp.csv ./result-io-backend-io-uring-tcp.csv ./result-io-backend-diff-tcp.csv
+fi
+
+echo 'Create plots...'
+gnuplot plot-io-backend.gp
@@ -0,0 +1,51 @@
+# Terminal and output
+set terminal pdfcairo font ',11' size 4.5,6
+
+fres = "result-io-backend"
+fres_epoll_csv = "result-io-backend-epoll.csv"
+fres_io_uring_csv = "result-io-backend-io-uring.csv"
+fres_epoll_tcp_csv = "result-io-backend-epoll-tcp.csv"
+fres_io_uring_tcp_csv = "result-io-backend-io-uring-tcp.csv"
+
+set output fres.".pdf"
+set datafile separator ";"
+
+version=system("head -1 ".fres_epoll_csv." | cut -c3-")
+numruns=system("sed '3q;d' ".fres_epoll_csv." | awk  -F ';' '{print $1}'")
+participants=system("sed '3q;d' ".fres_epoll_csv." | awk -F ';' '{print $2}'")
+msgcount=system("sed '3q;d' ".fres_epoll_csv." | awk -F ';' '{print $4}'")
+duration=system("sed '3q;d' ".fres_epoll_csv." | awk -F ';' '{print $5}'")
+
+# Common layout
+set multiplot layout 2,1 title "\n\n\n\n\n\n\n\n\n"
+
+set label 1 "{/:Bold io\\_uring vs. epoll}\n\n ".version."\n--number-simulation-runs ".numruns."\n--simulation-duration ".duration."\n--number-participants ".participants."\n--message-count ".msgcount."\n--message-size <var>"\
+at screen 0.13,0.97 left
+
+set auto
+set log x 2
+set xl 'Message size (B)' offset 0,0.3
+set key t r
+
+# Data columns
+# 1        2             3        4         5         6        7        8            9           10              11       12           13       14
+# numruns, participants, msgsize, msgcount, duration, numsent, runtime, runtime_err, throughput, throughput_err, speedup, speedup_err, msgrate, msgrate_err
+
+# Plot 1: Message rate
+set yl 'Message rate (kilocount/s)'
+p fres_epoll_csv        u 3:($13/1000) w l lc 1 not, '' u 3:($13/1000):($14/1000) w yerr pt 2 ps 0.8 lc 1 t 'epoll (DomainSockets)',\
+  fres_io_uring_csv     u 3:($13/1000) w l lc 2 not, '' u 3:($13/1000):($14/1000) w yerr pt 2 ps 0.8 lc 2 t 'io\_uring (DomainSockets)',\
+  fres_epoll_tcp_csv    u 3:($13/1000) w l lc 3 not, '' u 3:($13/1000):($14/1000) w yerr pt 2 ps 0.8 lc 3 t 'epoll (TCP)',\
+  fres_io_uring_tcp_csv u 3:($13/1000) w l lc 4 not, '' u 3:($13/1000):($14/1000) w yerr pt 2 ps 0.8 lc 4 t 'io\_uring (TCP)'
+
+unset label
+
+# Plot 2: Throughput
+set yl 'Throughput (MiB/s)'
+set key t l
+p fres_epoll_csv        u 3:9 w l lc 1 not, '' u 3:9:10 w yerr pt 2 ps 0.8 lc 1 t 'epoll (DomainSockets)',\
+  fres_io_uring_csv     u 3:9 w l lc 2 not, '' u 3:9:10 w yerr pt 2 ps 0.8 lc 2 t 'io\_uring (DomainSockets)',\
+  fres_epoll_tcp_csv    u 3:9 w l lc 3 not, '' u 3:9:10 w yerr pt 2 ps 0.8 lc 3 t 'epoll (TCP)',\
+  fres_io_uring_tcp_csv u 3:9 w l lc 4 not, '' u 3:9:10 w yerr pt 2 ps 0.8 lc 4 t 'io\_uring (TCP)'
+
+unset multiplot
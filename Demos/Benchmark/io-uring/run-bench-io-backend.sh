@@ -0,0 +1,28 @@
+#!/bin/sh
+#Usage: ./run-bench-io-backend.sh <path/to/SilKitDemoBenchmark> <path/to/result.csv> [<path/to/SilKitConfig>]
+
+EXE=$1
+CSVFILE=$2
+CONFIGFILE=${3:-}
+CONFIGARG=""
+if [ ! -z "${CONFIGFILE}" ]; then
+    CONFIGARG="--configuration ${CONFIGFILE}"
+fi
+
+REPEAT=20
+SIMTIME=1
+NUMPART=2
+MSGCOUNT=100
+
+for msgsize in 64 256 1024 4096 16384 65536
+do
+  echo "Run SilKitBenchmarkDemo with RUNS=${REPEAT}, T=${SIMTIME}s, PARTICIPANTS=${NUMPART}, MSGCOUNT=${MSGCOUNT}, MSGSIZE=${msgsize}B, CONFIG=${CONFIGFILE}, CSV=${CSVFILE}"
+  $EXE --number-simulation-runs ${REPEAT} \
+       --simulation-duration ${SIMTIME} \
+       --number-participants ${NUMPART} \
+       --message-count ${MSGCOUNT} \
+       --message-size ${msgsize} \
+       --write-csv ${CSVFILE} \
+       ${CONFIGARG} > /dev/null
+
+done
@@ -1,16 +1,20 @@
-#!/bin/sh
-echo 'Cleanup'
-rm ./result-msg-size-scaling.csv
-rm ./result-msg-size-scaling-tcp.csv
-rm ./result-msg-size-scaling.pdf
-
-EXE=$1
-
-echo 'Run benchmarks with domain sockets ...'
-./run-bench-msg-size-scaling.sh $1 ./result-msg-size-scaling.csv 
-
-echo 'Run benchmarks with TCP ...'
-./run-bench-msg-size-scaling.sh $1 ./result-msg-size-scaling-tcp.csv ./SilKitConfig_DemoBenchmark_DomainSockets_Off.yaml
-
-echo 'Create plots...'
-gnuplot plot-msg-size-scaling.gp
+#!/bin/sh
+echo 'Cleanup'
+rm ./result-msg-size-scaling.csv
+rm ./result-msg-size-scaling-tcp.csv
+rm ./result-msg-size-scaling-shm.csv
+rm ./result-msg-size-scaling.pdf
+
+EXE=$1
+
+echo 'Run benchmarks with domain sockets ...'
+./run-bench-msg-size-scaling.sh $1 ./result-msg-size-scaling.csv 
+
+echo 'Run benchmarks with TCP ...'
+./run-bench-msg-size-scaling.sh $1 ./result-msg-size-scaling-tcp.csv ./SilKitConfig_DemoBenchmark_DomainSockets_Off.yaml
+
+echo 'Run benchmarks with shared memory ...'
+./run-bench-msg-size-scaling.sh $1 ./result-msg-size-scaling-shm.csv ./SilKitConfig_DemoBenchmark_SharedMemory.yaml
+
+echo 'Create plots...'
+gnuplot plot-msg-size-scaling.gp
@@ -744,6 +744,18 @@ extern "C"
         return globalCapi->SilKit_Participant_GetLogger(outLogger, participant);
     }
 
+    SilKit_ReturnCode SilKitCALL
+    SilKit_Experimental_Participant_BeginServiceRegistrationBatch(SilKit_Participant* participant)
+    {
+        return globalCapi->SilKit_Experimental_Participant_BeginServiceRegistrationBatch(participant);
+    }
+
+    SilKit_ReturnCode SilKitCALL
+    SilKit_Experimental_Participant_EndServiceRegistrationBatch(SilKit_Participant* participant)
+    {
+        return globalCapi->SilKit_Experimental_Participant_EndServiceRegistrationBatch(participant);
+    }
+
     // ParticipantConfiguration
 
     SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
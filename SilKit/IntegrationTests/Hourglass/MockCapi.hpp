@@ -401,6 +401,12 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_Participant_GetLogger,
                 (SilKit_Logger * *outLogger, SilKit_Participant* participant));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_BeginServiceRegistrationBatch,
+                (SilKit_Participant * participant));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_EndServiceRegistrationBatch,
+                (SilKit_Participant * participant));
+
     // ParticipantConfiguration
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_ParticipantConfiguration_FromString,
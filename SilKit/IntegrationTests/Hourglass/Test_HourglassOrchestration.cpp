@@ -573,6 +573,17 @@ TEST_F(HourglassOrchestrationTest, SilKit_Experimental_SystemController_Create)
     SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::CreateSystemController(&participant);
 }
 
+TEST_F(HourglassOrchestrationTest, SilKit_Experimental_Participant_ServiceRegistrationBatch)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Participant participant{mockParticipant};
+
+    EXPECT_CALL(capi, SilKit_Experimental_Participant_BeginServiceRegistrationBatch(mockParticipant));
+    EXPECT_CALL(capi, SilKit_Experimental_Participant_EndServiceRegistrationBatch(mockParticipant));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::BeginServiceRegistrationBatch(&participant);
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::EndServiceRegistrationBatch(&participant);
+}
+
 TEST_F(HourglassOrchestrationTest, SilKit_Experimental_SystemController_AbortSimulation)
 {
     SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Experimental::Services::Orchestration::SystemController
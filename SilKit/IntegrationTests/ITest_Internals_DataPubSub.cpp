@@ -306,6 +306,230 @@ TEST_F(ITest_Internals_DataPubSub, test_3pub_4sub_sync_4topics)
     RunSyncTest(pubsubs);
 }
 
+// Multiple publishers and subscribers, with multiple IO worker threads in each participant
+TEST_F(ITest_Internals_DataPubSub, test_3pub_4sub_sync_io_worker_threads)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+    const uint32_t numMsgToReceive = numMsgToPublish * 3;
+
+    const auto configString = R"raw(
+Middleware:
+  IoWorkerThreads: 4
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint8_t d = 0; d < numMsgToPublish; d++)
+    {
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+    }
+
+    std::vector<PubSubParticipant> pubsubs;
+    for (const auto& name : {"Pub1", "Pub2", "Pub3"})
+    {
+        pubsubs.push_back({name, {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}, config});
+    }
+    for (const auto& name : {"Sub1", "Sub2", "Sub3", "Sub4"})
+    {
+        pubsubs.push_back(
+            {name,
+             {},
+             {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1, expectedDataUnordered}},
+             config});
+    }
+
+    RunSyncTest(pubsubs);
+}
+
+// Participants on the same host exchanging messages via shared memory
+TEST_F(ITest_Internals_DataPubSub, test_3pub_4sub_sync_shared_memory)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+    const uint32_t numMsgToReceive = numMsgToPublish * 3;
+
+    const auto configString = R"raw(
+Middleware:
+  EnableSharedMemory: true
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint8_t d = 0; d < numMsgToPublish; d++)
+    {
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+    }
+
+    std::vector<PubSubParticipant> pubsubs;
+    for (const auto& name : {"Pub1", "Pub2", "Pub3"})
+    {
+        pubsubs.push_back({name, {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}, config});
+    }
+    for (const auto& name : {"Sub1", "Sub2", "Sub3", "Sub4"})
+    {
+        pubsubs.push_back(
+            {name,
+             {},
+             {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1, expectedDataUnordered}},
+             config});
+    }
+
+    RunSyncTest(pubsubs);
+}
+
+// Messages larger than the shared memory ring are transferred in pieces
+TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_sync_shared_memory_largemsg)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+    const uint32_t numMsgToReceive = numMsgToPublish;
+    const size_t messageSize = 3 * 1024 * 1024;
+
+    const auto configString = R"raw(
+Middleware:
+  EnableSharedMemory: true
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<PubSubParticipant> pubsubs;
+    pubsubs.push_back({"Pub1", {{"PubCtrl1", "TopicA", {"A"}, {}, 0, messageSize, numMsgToPublish}}, {}, config});
+    pubsubs.push_back({"Sub1", {}, {{"SubCtrl1", "TopicA", {"A"}, {}, messageSize, numMsgToReceive, 1}}, config});
+
+    RunSyncTest(pubsubs);
+}
+
+// Messages of a simulation step are written at the end of the step
+TEST_F(ITest_Internals_DataPubSub, test_3pub_4sub_sync_message_coalescing)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+    const uint32_t numMsgToReceive = numMsgToPublish * 3;
+
+    const auto configString = R"raw(
+Middleware:
+  EnableMessageCoalescing: true
+  MessageCoalescingMaxBytes: 4096
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint8_t d = 0; d < numMsgToPublish; d++)
+    {
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+    }
+
+    std::vector<PubSubParticipant> pubsubs;
+    for (const auto& name : {"Pub1", "Pub2", "Pub3"})
+    {
+        pubsubs.push_back({name, {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}, config});
+    }
+    for (const auto& name : {"Sub1", "Sub2", "Sub3", "Sub4"})
+    {
+        pubsubs.push_back(
+            {name,
+             {},
+             {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1, expectedDataUnordered}},
+             config});
+    }
+
+    RunSyncTest(pubsubs);
+}
+
+// The messages published in a simulation step are written with a single socket write
+TEST_F(ITest_Internals_DataPubSub, test_4pub_1sub_sync_message_coalescing_writes_per_step)
+{
+    const uint32_t numSteps = 50;
+    const uint32_t numPublishers = 4;
+
+    const auto configString = R"raw(
+Middleware:
+  EnableMessageCoalescing: true
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint8_t d = 0; d < numSteps; d++)
+    {
+        for (uint32_t p = 0; p < numPublishers; p++)
+        {
+            expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, d));
+        }
+    }
+
+    std::vector<DataPublisherInfo> dataPublishers;
+    for (uint32_t p = 0; p < numPublishers; p++)
+    {
+        dataPublishers.push_back({"PubCtrl" + std::to_string(p), "TopicA", {"A"}, {}, 0, defaultMsgSize, numSteps});
+    }
+
+    std::vector<PubSubParticipant> pubsubs;
+    pubsubs.push_back({"Pub1", dataPublishers, {}, config});
+    pubsubs.push_back({"Sub1",
+                       {},
+                       {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numSteps * numPublishers, numPublishers,
+                         expectedDataUnordered}},
+                       config});
+
+    RunSyncTest(pubsubs);
+
+    // Per step, one write of the published messages and one of the NextSimTask. Without coalescing, every published
+    // message is written on its own, which takes five writes per step.
+    const auto& publisher = pubsubs.front();
+    ASSERT_EQ(publisher.numWritesAtFirstStep.count("Sub1"), 1u);
+    ASSERT_EQ(publisher.numWritesAtLastStep.count("Sub1"), 1u);
+    const auto numWrites = publisher.numWritesAtLastStep.at("Sub1") - publisher.numWritesAtFirstStep.at("Sub1");
+    EXPECT_LT(numWrites, 3 * numSteps);
+}
+
+// Direct connections are only opened between the participants exchanging data, everything else is relayed
+TEST_F(ITest_Internals_DataPubSub, test_2pub_2sub_sync_lazy_peer_connections)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+    const uint32_t numMsgToReceive = numMsgToPublish;
+
+    const auto configString = R"raw(
+Middleware:
+  RegistryAsFallbackProxy: true
+  EnableLazyPeerConnections: true
+)raw";
+    auto config = SilKit::Config::ParticipantConfigurationFromStringImpl(configString);
+
+    std::vector<PubSubParticipant> pubsubs;
+    pubsubs.push_back({"Pub1", {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}, config});
+    pubsubs.push_back({"Pub2", {{"PubCtrl1", "TopicB", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}, config});
+    pubsubs.push_back(
+        {"Sub1", {}, {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1}}, config});
+    pubsubs.push_back(
+        {"Sub2", {}, {{"SubCtrl1", "TopicB", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1}}, config});
+
+    RunSyncTest(pubsubs);
+
+    // Every participant knows the others as peers, but writes to a socket of its own only for its data partner. The
+    // time synchronization of all four participants is relayed.
+    const std::map<std::string, std::string> dataPartners{
+        {"Pub1", "Sub1"}, {"Sub1", "Pub1"}, {"Pub2", "Sub2"}, {"Sub2", "Pub2"}};
+    for (const auto& pubsub : pubsubs)
+    {
+        std::vector<std::string> directlyConnected;
+        for (const auto& other : dataPartners)
+        {
+            if (other.first == pubsub.name)
+            {
+                continue;
+            }
+            ASSERT_EQ(pubsub.numWritesAtEnd.count(other.first), 1u) << pubsub.name << " does not know " << other.first;
+            if (pubsub.numWritesAtEnd.at(other.first) > 0)
+            {
+                directlyConnected.push_back(other.first);
+            }
+        }
+        EXPECT_EQ(directlyConnected, std::vector<std::string>{dataPartners.at(pubsub.name)}) << pubsub.name;
+    }
+}
+
 //--------------------------------------
 // Topics
 
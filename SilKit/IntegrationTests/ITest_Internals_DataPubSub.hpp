@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <map>
+
 #include "silkit/SilKit.hpp"
 #include "silkit/services/orchestration/all.hpp"
 #include "silkit/services/all.hpp"
@@ -213,8 +215,25 @@ protected:
         std::promise<void> allSentPromise;
         bool allSent{false};
 
+        // Socket writes per remote participant, sampled before the first and after the last publishing step
+        std::map<std::string, uint64_t> numWritesAtFirstStep;
+        std::map<std::string, uint64_t> numWritesAtLastStep;
+        // Sampled once the lifecycle finished, while all connections are still open
+        std::map<std::string, uint64_t> numWritesAtEnd;
+        bool isFirstStep{true};
+
         std::chrono::milliseconds communicationTimeout{20000ms};
 
+        auto SampleNumWrites() -> std::map<std::string, uint64_t>
+        {
+            std::map<std::string, uint64_t> numWrites;
+            for (const auto& peer : participantImpl->GetTrafficStatistics().peers)
+            {
+                numWrites[peer.participantName] = peer.numWrites;
+            }
+            return numWrites;
+        }
+
         void PrepareAllReceivedPromise()
         {
             if (std::all_of(dataSubscribers.begin(), dataSubscribers.end(), [](const auto& dsInfo) {
@@ -371,15 +390,25 @@ protected:
                 timeSyncService->SetSimulationStepHandler(
                     [&participant, publishTask](std::chrono::nanoseconds /*now*/,
                                                 std::chrono::nanoseconds /*duration*/) {
-                        if (!participant.dataPublishers.empty())
+                        if (!participant.dataPublishers.empty() && !participant.allSent)
                         {
+                            if (participant.isFirstStep)
+                            {
+                                participant.numWritesAtFirstStep = participant.SampleNumWrites();
+                                participant.isFirstStep = false;
+                            }
                             publishTask();
                             participant.CheckAllSentPromise();
+                            if (participant.allSent)
+                            {
+                                participant.numWritesAtLastStep = participant.SampleNumWrites();
+                            }
                         }
                     },
                     1s);
                 auto finalStateFuture = lifecycleService->StartLifecycle();
                 finalStateFuture.get();
+                participant.numWritesAtEnd = participant.SampleNumWrites();
             }
             else
             {
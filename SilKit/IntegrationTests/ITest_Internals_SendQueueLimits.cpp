@@ -0,0 +1,149 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "silkit/SilKit.hpp"
+#include "silkit/services/pubsub/all.hpp"
+#include "silkit/vendor/CreateSilKitRegistry.hpp"
+
+#include "GetTestPid.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::PubSub;
+
+// The subscriber blocks its only IO thread in the handler of the first message, so that it stops reading from its
+// sockets, and the sending queue of the publisher fills up.
+struct ITest_Internals_SendQueueLimits : testing::Test
+{
+    void SetUp() override
+    {
+        registry = SilKit::Vendor::Vector::CreateSilKitRegistry(SilKit::Config::ParticipantConfigurationFromString(""));
+        registryUri = registry->StartListening(MakeTestRegistryUri());
+
+        subscriber = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(""), "Subscriber",
+                                               registryUri);
+        subscriber->CreateDataSubscriber("Subscriber", spec, [this](IDataSubscriber*, const DataMessageEvent&) {
+            std::call_once(firstMessageFlag, [this] { firstMessageReceived.set_value(); });
+            subscriberReleased.wait();
+        });
+    }
+
+    void TearDown() override
+    {
+        ReleaseSubscriber();
+        publisher.reset();
+        subscriber.reset();
+        registry.reset();
+    }
+
+    auto CreatePublisher(const std::string& overflowPolicy) -> IDataPublisher*
+    {
+        publisher = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(R"(
+Middleware:
+  SendQueueMaxBytes: 1048576
+  SendQueueOverflowPolicy: )" + overflowPolicy),
+                                              "Publisher", registryUri);
+        return publisher->CreateDataPublisher("Publisher", spec);
+    }
+
+    // Publish small messages until the subscriber discovered the publisher and stalled in the handler
+    void WaitUntilSubscriberStalled(IDataPublisher* dataPublisher)
+    {
+        auto firstMessage = firstMessageReceived.get_future();
+        const std::vector<uint8_t> probe(1);
+        for (auto i = 0; i < 500 && firstMessage.wait_for(10ms) != std::future_status::ready; ++i)
+        {
+            dataPublisher->Publish(probe);
+        }
+        ASSERT_EQ(firstMessage.wait_for(0s), std::future_status::ready);
+    }
+
+    void ReleaseSubscriber()
+    {
+        std::call_once(releaseFlag, [this] { releaseSubscriber.set_value(); });
+    }
+
+    const PubSubSpec spec{"SendQueueLimits", ""};
+    // Far above the socket buffers, so that the queue fills up while the subscriber does not read
+    const std::vector<uint8_t> payload = std::vector<uint8_t>(64 * 1024);
+    static constexpr int numMessages = 2000;
+
+    std::string registryUri;
+    std::once_flag firstMessageFlag;
+    std::promise<void> firstMessageReceived;
+    std::once_flag releaseFlag;
+    std::promise<void> releaseSubscriber;
+    std::shared_future<void> subscriberReleased{releaseSubscriber.get_future().share()};
+
+    std::unique_ptr<SilKit::Vendor::Vector::ISilKitRegistry> registry;
+    std::unique_ptr<SilKit::IParticipant> subscriber;
+    std::unique_ptr<SilKit::IParticipant> publisher;
+};
+
+constexpr int ITest_Internals_SendQueueLimits::numMessages;
+
+TEST_F(ITest_Internals_SendQueueLimits, publish_throws_while_the_queue_to_a_stalled_subscriber_is_full)
+{
+    auto* dataPublisher = CreatePublisher("Error");
+    WaitUntilSubscriberStalled(dataPublisher);
+
+    auto publishAll = [this, dataPublisher] {
+        for (auto i = 0; i < numMessages; ++i)
+        {
+            dataPublisher->Publish(payload);
+        }
+    };
+    EXPECT_THROW(publishAll(), SilKit::SilKitError);
+}
+
+TEST_F(ITest_Internals_SendQueueLimits, publish_blocks_while_the_queue_to_a_stalled_subscriber_is_full)
+{
+    auto* dataPublisher = CreatePublisher("Block");
+    WaitUntilSubscriberStalled(dataPublisher);
+
+    std::atomic<int> numPublished{0};
+    auto publishing = std::async(std::launch::async, [this, dataPublisher, &numPublished] {
+        for (auto i = 0; i < numMessages; ++i)
+        {
+            dataPublisher->Publish(payload);
+            ++numPublished;
+        }
+    });
+
+    EXPECT_EQ(publishing.wait_for(2s), std::future_status::timeout);
+    EXPECT_LT(numPublished, numMessages);
+
+    ReleaseSubscriber();
+    ASSERT_EQ(publishing.wait_for(30s), std::future_status::ready);
+    EXPECT_EQ(numPublished, numMessages);
+}
+
+} // namespace
@@ -92,3 +92,55 @@ function(add_silkit_test)
         set_tests_properties(${executableName} PROPERTIES ENVIRONMENT "PATH=${compilerDir};")
     endif()
 endfunction(add_silkit_test)
+
+# Micro benchmarks of the SIL Kit internals, written as gtest cases which print their timings. They are not registered
+# with CTest, because their results depend on the machine, and are only built with SILKIT_BUILD_BENCHMARKS.
+function(add_silkit_benchmark)
+    if(NOT ${SILKIT_BUILD_TESTS} OR NOT ${SILKIT_BUILD_BENCHMARKS})
+        return()
+    endif()
+
+    set(multiValueArgs SOURCES LIBS)
+
+    cmake_parse_arguments(PARSED_ARGS
+        ""
+        ""
+        "${multiValueArgs}"
+        ${ARGN}
+    )
+
+    if(NOT PARSED_ARGS_UNPARSED_ARGUMENTS)
+        message(FATAL_ERROR "add_silkit_benchmark function failed because no executable name was specified (UNPARSED_ARGUMENTS were empty).")
+    endif()
+
+    list(GET PARSED_ARGS_UNPARSED_ARGUMENTS 0 executableName)
+
+    if(NOT PARSED_ARGS_SOURCES)
+        message(FATAL_ERROR "add_silkit_benchmark function for ${executableName} has an empty source list.")
+    endif()
+
+    add_executable(${executableName}
+        ${PARSED_ARGS_SOURCES}
+    )
+
+    set_property(TARGET ${executableName} PROPERTY FOLDER "Benchmarks")
+
+    target_link_libraries(${executableName}
+        PRIVATE SilKitInterface
+        gtest
+        gmock_main
+        ${PARSED_ARGS_LIBS}
+    )
+    target_compile_definitions(${executableName}
+        PRIVATE
+        UNIT_TEST
+    )
+    set_target_properties(${executableName} PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+        LIBRARY_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+    )
+
+    if (MSVC)
+        target_compile_options(${executableName} PRIVATE "/bigobj")
+    endif(MSVC)
+endfunction(add_silkit_benchmark)
@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <limits.h>
 #include "silkit/capi/SilKitMacros.h"
 #include "silkit/capi/Types.h"
+#include "silkit/capi/InterfaceIdentifiers.h"
 #include "silkit/capi/Logger.h"
 
 #pragma pack(push)
@@ -78,6 +79,160 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Participant_GetLogger(SilKit_Logge
 
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Participant_GetLogger_t)(SilKit_Logger** outLogger, SilKit_Participant* participant);
 
+/*! \brief Begin a batch of services, which are registered at the other participants in a single round.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * Until \ref SilKit_Experimental_Participant_EndServiceRegistrationBatch is called, creating a controller does not
+ * wait until the other participants acknowledged its subscriptions.
+ *
+ * \param participant The simulation participant on which the services are created.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL
+SilKit_Experimental_Participant_BeginServiceRegistrationBatch(SilKit_Participant* participant);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_BeginServiceRegistrationBatch_t)(
+    SilKit_Participant* participant);
+
+/*! \brief End a batch of services and wait until the other participants acknowledged their subscriptions.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * The subscriptions of all services created since \ref SilKit_Experimental_Participant_BeginServiceRegistrationBatch
+ * are announced with a single message per participant.
+ *
+ * \param participant The simulation participant on which the services are created.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL
+SilKit_Experimental_Participant_EndServiceRegistrationBatch(SilKit_Participant* participant);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_EndServiceRegistrationBatch_t)(
+    SilKit_Participant* participant);
+
+/*! \brief The sending queue to a remote participant reached its limit, or drained again.
+ *
+ * @warning This struct is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_SendQueueHighWaterMarkEvent
+{
+    SilKit_StructHeader structHeader;
+    /*! \brief Name of the remote participant the queued messages are sent to. */
+    const char* participantName;
+    /*! \brief True if the queue reached its limit, false if it drained to half of its limit afterwards. */
+    SilKit_Bool isAboveHighWaterMark;
+    /*! \brief Number of messages in the queue. */
+    uint64_t queuedMessages;
+    /*! \brief Number of bytes in the queue. */
+    uint64_t queuedBytes;
+    /*! \brief Number of messages dropped from the queue so far. */
+    uint64_t numDroppedMessages;
+} SilKit_Experimental_SendQueueHighWaterMarkEvent;
+
+/*! Callback type to indicate that the sending queue to a remote participant crossed its high-water mark.
+ * Cf., \ref SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler
+ */
+typedef void (SilKitFPTR *SilKit_Experimental_SendQueueHighWaterMarkHandler_t)(
+    void* context, SilKit_Participant* participant, const SilKit_Experimental_SendQueueHighWaterMarkEvent* event);
+
+/*! \brief Set a callback for the sending queues to the remote participants crossing their high-water mark.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * The limits of the sending queues are configured in the Middleware section of the participant configuration.
+ * The handler is called by the thread that sent the message filling the queue, or by a thread of the network IO
+ * once the queue drained. A previously set handler is replaced.
+ *
+ * \param participant The simulation participant sending the messages.
+ * \param context The user context pointer made available to the handler.
+ * \param handler The handler to be called when a sending queue reached its limit, or drained again.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SendQueueHighWaterMarkHandler_t handler);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler_t)(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SendQueueHighWaterMarkHandler_t handler);
+
+/*! \brief The messages and bytes exchanged with a remote participant since it was connected.
+ *
+ * @warning This struct is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_PeerTrafficStatistics
+{
+    SilKit_StructHeader structHeader;
+    /*! \brief Name of the remote participant, or of the registry. */
+    const char* participantName;
+    /*! \brief Number of messages sent to the remote participant. */
+    uint64_t numSentMessages;
+    /*! \brief Number of bytes sent to the remote participant. */
+    uint64_t numSentBytes;
+    /*! \brief Number of socket writes, a write may contain multiple messages. */
+    uint64_t numWrites;
+    /*! \brief Largest number of messages waiting in the sending queue. */
+    uint64_t maxQueuedMessages;
+    /*! \brief Largest number of bytes waiting in the sending queue. */
+    uint64_t maxQueuedBytes;
+    /*! \brief Number of messages received from the remote participant. */
+    uint64_t numReceivedMessages;
+    /*! \brief Number of bytes received from the remote participant. */
+    uint64_t numReceivedBytes;
+} SilKit_Experimental_PeerTrafficStatistics;
+
+/*! \brief The messages of a single message type exchanged on a network.
+ *
+ * @warning This struct is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ */
+typedef struct SilKit_Experimental_LinkTrafficStatistics
+{
+    SilKit_StructHeader structHeader;
+    /*! \brief Name of the network. */
+    const char* networkName;
+    /*! \brief Name of the message type, e.g., WireCanFrameEvent. */
+    const char* messageTypeName;
+    /*! \brief Number of messages sent by the services of this participant. */
+    uint64_t numSentMessages;
+    /*! \brief Number of messages received from remote participants. */
+    uint64_t numReceivedMessages;
+} SilKit_Experimental_LinkTrafficStatistics;
+
+/*! Callback type to receive the traffic statistics of a remote participant.
+ * Cf., \ref SilKit_Experimental_Participant_GetTrafficStatistics
+ */
+typedef void (SilKitFPTR *SilKit_Experimental_PeerTrafficStatisticsHandler_t)(
+    void* context, SilKit_Participant* participant, const SilKit_Experimental_PeerTrafficStatistics* statistics);
+
+/*! Callback type to receive the traffic statistics of a network and message type.
+ * Cf., \ref SilKit_Experimental_Participant_GetTrafficStatistics
+ */
+typedef void (SilKitFPTR *SilKit_Experimental_LinkTrafficStatisticsHandler_t)(
+    void* context, SilKit_Participant* participant, const SilKit_Experimental_LinkTrafficStatistics* statistics);
+
+/*! \brief Read the traffic counters of the participant, per remote participant and per network and message type.
+ *
+ * @warning This function is not part of the stable API and ABI of the SIL Kit. It may be removed at any time without
+ *          prior notice.
+ *
+ * The handlers are called for each remote participant and each network and message type, before this function
+ * returns. The statistics passed to the handlers are only valid during the call.
+ *
+ * \param participant The simulation participant.
+ * \param context The user context pointer made available to the handlers.
+ * \param peerHandler The handler called for each remote participant, may be NULL.
+ * \param linkHandler The handler called for each network and message type, may be NULL.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetTrafficStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerTrafficStatisticsHandler_t peerHandler,
+    SilKit_Experimental_LinkTrafficStatisticsHandler_t linkHandler);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_GetTrafficStatistics_t)(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerTrafficStatisticsHandler_t peerHandler,
+    SilKit_Experimental_LinkTrafficStatisticsHandler_t linkHandler);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
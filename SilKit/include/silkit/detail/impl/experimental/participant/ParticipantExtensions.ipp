@@ -42,6 +42,34 @@ auto CreateSystemController(SilKit::IParticipant* cppIParticipant)
     return cppParticipant.ExperimentalCreateSystemController();
 }
 
+void BeginServiceRegistrationBatch(SilKit::IParticipant* cppIParticipant)
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    cppParticipant.ExperimentalBeginServiceRegistrationBatch();
+}
+
+void EndServiceRegistrationBatch(SilKit::IParticipant* cppIParticipant)
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    cppParticipant.ExperimentalEndServiceRegistrationBatch();
+}
+
+void SetSendQueueHighWaterMarkHandler(SilKit::IParticipant* cppIParticipant, SendQueueHighWaterMarkHandler handler)
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    cppParticipant.ExperimentalSetSendQueueHighWaterMarkHandler(std::move(handler));
+}
+
+auto GetTrafficStatistics(SilKit::IParticipant* cppIParticipant) -> TrafficStatistics
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    return cppParticipant.ExperimentalGetTrafficStatistics();
+}
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
@@ -52,6 +80,10 @@ namespace SilKit {
 namespace Experimental {
 namespace Participant {
 using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::CreateSystemController;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::BeginServiceRegistrationBatch;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::EndServiceRegistrationBatch;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::SetSendQueueHighWaterMarkHandler;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetTrafficStatistics;
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
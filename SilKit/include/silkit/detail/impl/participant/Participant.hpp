@@ -30,6 +30,8 @@
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/participant/exception.hpp"
 
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
+
 #include "silkit/detail/impl/services/can/CanController.hpp"
 
 #include "silkit/detail/impl/services/ethernet/EthernetController.hpp"
@@ -100,6 +102,15 @@ public:
     inline auto ExperimentalCreateSystemController()
         -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+    inline void ExperimentalBeginServiceRegistrationBatch();
+
+    inline void ExperimentalEndServiceRegistrationBatch();
+
+    inline void ExperimentalSetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler);
+
+    inline auto ExperimentalGetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics;
+
 public:
     inline auto Get() const -> SilKit_Participant*;
 
@@ -134,6 +145,8 @@ private:
     std::unique_ptr<Impl::Experimental::Services::Orchestration::SystemController> _systemController;
 
     std::unique_ptr<Impl::Services::Logging::Logger> _logger;
+
+    std::unique_ptr<SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler> _sendQueueHighWaterMarkHandler;
 };
 
 } // namespace Impl
@@ -145,6 +158,8 @@ DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
 //  Inline Implementations
 // ================================================================================
 
+#include "silkit/detail/impl/ThrowOnError.hpp"
+
 namespace SilKit {
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
 namespace Impl {
@@ -243,6 +258,89 @@ auto Participant::ExperimentalCreateSystemController()
     return _systemController.get();
 }
 
+void Participant::ExperimentalBeginServiceRegistrationBatch()
+{
+    const auto returnCode = SilKit_Experimental_Participant_BeginServiceRegistrationBatch(_participant);
+    ThrowOnError(returnCode);
+}
+
+void Participant::ExperimentalEndServiceRegistrationBatch()
+{
+    const auto returnCode = SilKit_Experimental_Participant_EndServiceRegistrationBatch(_participant);
+    ThrowOnError(returnCode);
+}
+
+void Participant::ExperimentalSetSendQueueHighWaterMarkHandler(
+    SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler)
+{
+    auto ownedHandlerPtr =
+        std::make_unique<SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler>(std::move(handler));
+
+    const auto cHandler = [](void* context, SilKit_Participant* participant,
+                             const SilKit_Experimental_SendQueueHighWaterMarkEvent* cEvent) {
+        SILKIT_UNUSED_ARG(participant);
+
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent cxxEvent;
+        cxxEvent.participantName = std::string{cEvent->participantName};
+        cxxEvent.isAboveHighWaterMark = cEvent->isAboveHighWaterMark == SilKit_True;
+        cxxEvent.queuedMessages = cEvent->queuedMessages;
+        cxxEvent.queuedBytes = cEvent->queuedBytes;
+        cxxEvent.numDroppedMessages = cEvent->numDroppedMessages;
+
+        const auto handlerPtr = static_cast<SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler*>(context);
+        (*handlerPtr)(cxxEvent);
+    };
+
+    const auto returnCode =
+        SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler(_participant, ownedHandlerPtr.get(), cHandler);
+    ThrowOnError(returnCode);
+
+    _sendQueueHighWaterMarkHandler = std::move(ownedHandlerPtr);
+}
+
+auto Participant::ExperimentalGetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics
+{
+    SilKit::Experimental::Participant::TrafficStatistics trafficStatistics;
+
+    const auto cPeerHandler = [](void* context, SilKit_Participant* participant,
+                                 const SilKit_Experimental_PeerTrafficStatistics* cStatistics) {
+        SILKIT_UNUSED_ARG(participant);
+
+        SilKit::Experimental::Participant::PeerTrafficStatistics cxxStatistics;
+        cxxStatistics.participantName = std::string{cStatistics->participantName};
+        cxxStatistics.numSentMessages = cStatistics->numSentMessages;
+        cxxStatistics.numSentBytes = cStatistics->numSentBytes;
+        cxxStatistics.numWrites = cStatistics->numWrites;
+        cxxStatistics.maxQueuedMessages = cStatistics->maxQueuedMessages;
+        cxxStatistics.maxQueuedBytes = cStatistics->maxQueuedBytes;
+        cxxStatistics.numReceivedMessages = cStatistics->numReceivedMessages;
+        cxxStatistics.numReceivedBytes = cStatistics->numReceivedBytes;
+
+        static_cast<SilKit::Experimental::Participant::TrafficStatistics*>(context)->peers.push_back(
+            std::move(cxxStatistics));
+    };
+
+    const auto cLinkHandler = [](void* context, SilKit_Participant* participant,
+                                 const SilKit_Experimental_LinkTrafficStatistics* cStatistics) {
+        SILKIT_UNUSED_ARG(participant);
+
+        SilKit::Experimental::Participant::LinkTrafficStatistics cxxStatistics;
+        cxxStatistics.networkName = std::string{cStatistics->networkName};
+        cxxStatistics.messageTypeName = std::string{cStatistics->messageTypeName};
+        cxxStatistics.numSentMessages = cStatistics->numSentMessages;
+        cxxStatistics.numReceivedMessages = cStatistics->numReceivedMessages;
+
+        static_cast<SilKit::Experimental::Participant::TrafficStatistics*>(context)->links.push_back(
+            std::move(cxxStatistics));
+    };
+
+    const auto returnCode = SilKit_Experimental_Participant_GetTrafficStatistics(_participant, &trafficStatistics,
+                                                                                 cPeerHandler, cLinkHandler);
+    ThrowOnError(returnCode);
+
+    return trafficStatistics;
+}
+
 auto Participant::Get() const -> SilKit_Participant*
 {
     return _participant;
@@ -0,0 +1,88 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+
+/*! \brief The sending queue to a remote participant reached its limit, or drained again.
+*
+* The limits of the sending queues are configured by the Middleware fields SendQueueMaxBytes and SendQueueMaxMessages.
+* The event is delivered in the \ref SendQueueHighWaterMarkHandler.
+*/
+struct SendQueueHighWaterMarkEvent
+{
+    std::string participantName; //!< Name of the remote participant the queued messages are sent to.
+    //! True if the queue reached its limit, false if it drained to half of its limit afterwards.
+    bool isAboveHighWaterMark{false};
+    uint64_t queuedMessages{0}; //!< Number of messages in the queue.
+    uint64_t queuedBytes{0}; //!< Number of bytes in the queue.
+    uint64_t numDroppedMessages{0}; //!< Number of messages dropped from the queue so far.
+};
+
+/*! Callback type to indicate that the sending queue to a remote participant crossed its high-water mark.
+ *
+ * Cf., \ref SetSendQueueHighWaterMarkHandler
+ */
+using SendQueueHighWaterMarkHandler = std::function<void(const SendQueueHighWaterMarkEvent& event)>;
+
+/*! \brief The messages and bytes exchanged with a remote participant since it was connected.
+*
+* Messages relayed through the registry are counted for the remote participant, and again for the registry.
+*/
+struct PeerTrafficStatistics
+{
+    std::string participantName; //!< Name of the remote participant, or of the registry.
+    uint64_t numSentMessages{0}; //!< Number of messages sent to the remote participant.
+    uint64_t numSentBytes{0}; //!< Number of bytes sent to the remote participant.
+    uint64_t numWrites{0}; //!< Number of socket writes, a write may contain multiple messages.
+    uint64_t maxQueuedMessages{0}; //!< Largest number of messages waiting in the sending queue.
+    uint64_t maxQueuedBytes{0}; //!< Largest number of bytes waiting in the sending queue.
+    uint64_t numReceivedMessages{0}; //!< Number of messages received from the remote participant.
+    uint64_t numReceivedBytes{0}; //!< Number of bytes received from the remote participant.
+};
+
+//! \brief The messages of a single message type exchanged on a network.
+struct LinkTrafficStatistics
+{
+    std::string networkName; //!< Name of the network.
+    std::string messageTypeName; //!< Name of the message type, e.g., WireCanFrameEvent.
+    uint64_t numSentMessages{0}; //!< Number of messages sent by the services of this participant.
+    uint64_t numReceivedMessages{0}; //!< Number of messages received from remote participants.
+};
+
+//! \brief The traffic of a participant, per remote participant and per network and message type.
+struct TrafficStatistics
+{
+    std::vector<PeerTrafficStatistics> peers;
+    std::vector<LinkTrafficStatistics> links;
+};
+
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
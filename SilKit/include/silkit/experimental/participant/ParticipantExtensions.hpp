@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKitMacros.hpp"
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "silkit/detail/macros.hpp"
 
@@ -42,6 +43,56 @@ namespace Participant {
 DETAIL_SILKIT_CPP_API auto CreateSystemController(SilKit::IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+/*! \brief Begin a batch of services, which are registered at the other participants in a single round.
+*
+* Until EndServiceRegistrationBatch is called, creating a controller, publisher, subscriber, or RPC client or server
+* does not wait until the other participants acknowledged its subscriptions.
+* Messages sent to these services may not be received before EndServiceRegistrationBatch returned.
+*
+* \param participant The participant instance on which the services are created
+*
+* \throw SilKit::SilKitError The participant is invalid, or a batch was already begun.
+*/
+DETAIL_SILKIT_CPP_API void BeginServiceRegistrationBatch(SilKit::IParticipant* participant);
+
+/*! \brief End a batch of services and wait until the other participants acknowledged their subscriptions.
+*
+* The subscriptions of all services created since BeginServiceRegistrationBatch are announced with a single message
+* per participant.
+*
+* \param participant The participant instance on which the services are created
+*
+* \throw SilKit::SilKitError The participant is invalid, or no batch was begun.
+*/
+DETAIL_SILKIT_CPP_API void EndServiceRegistrationBatch(SilKit::IParticipant* participant);
+
+/*! \brief Set a callback for the sending queues to the remote participants crossing their high-water mark.
+*
+* The handler is called once the sending queue to a remote participant reached the limits configured by the
+* Middleware fields SendQueueMaxBytes and SendQueueMaxMessages, and again once it drained to half of them.
+* It is called by the thread that sent the message filling the queue, or by a thread of the network IO.
+* A previously set handler is replaced.
+*
+* \param participant The participant instance sending the messages
+* \param handler The handler to be called
+*
+* \throw SilKit::SilKitError The participant is invalid.
+*/
+DETAIL_SILKIT_CPP_API void SetSendQueueHighWaterMarkHandler(SilKit::IParticipant* participant,
+                                                            SendQueueHighWaterMarkHandler handler);
+
+/*! \brief Read the traffic counters of the participant.
+*
+* The counters are kept per remote participant (messages, bytes, socket writes and the largest sending queue) and
+* per network and message type (messages sent and received). They are counted from the time the remote participant
+* was connected, or the network was first used.
+*
+* \param participant The participant instance
+*
+* \throw SilKit::SilKitError The participant is invalid.
+*/
+DETAIL_SILKIT_CPP_API auto GetTrafficStatistics(SilKit::IParticipant* participant) -> TrafficStatistics;
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
@@ -49,6 +49,10 @@ void __silkit_force_include_experimental()
     // Participant extensions
     auto systemController = SilKit::Experimental::Participant::CreateSystemController(nullptr);
     SILKIT_UNUSED_ARG(systemController);
+    SilKit::Experimental::Participant::BeginServiceRegistrationBatch(nullptr);
+    SilKit::Experimental::Participant::EndServiceRegistrationBatch(nullptr);
+    SilKit::Experimental::Participant::SetSendQueueHighWaterMarkHandler(nullptr, {});
+    SilKit::Experimental::Participant::GetTrafficStatistics(nullptr);
 
     // LinController extensions
     auto handlerId =
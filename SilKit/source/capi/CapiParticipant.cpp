@@ -22,11 +22,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantConfiguration.hpp"
 #include "ParticipantConfigurationFromXImpl.hpp"
 #include "CreateParticipantImpl.hpp"
+#include "participant/ParticipantExtensionsImpl.hpp"
 
 #include "silkit/capi/SilKit.h"
 #include "silkit/SilKit.hpp"
 #include "silkit/services/logging/ILogger.hpp"
 #include "silkit/services/orchestration/all.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "CapiImpl.hpp"
 #include "TypeConversion.hpp"
@@ -102,6 +104,107 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_BeginServiceRegistrationBatch(
+    SilKit_Participant* participant)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+
+    auto cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    SilKit::Experimental::Participant::BeginServiceRegistrationBatchImpl(cppParticipant);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_EndServiceRegistrationBatch(
+    SilKit_Participant* participant)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+
+    auto cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    SilKit::Experimental::Participant::EndServiceRegistrationBatchImpl(cppParticipant);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_SendQueueHighWaterMarkHandler_t handler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+    ASSERT_VALID_HANDLER_PARAMETER(handler);
+
+    auto cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    SilKit::Experimental::Participant::SetSendQueueHighWaterMarkHandlerImpl(
+        cppParticipant,
+        [handler, context, participant](const SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent& cppEvent) {
+            SilKit_Experimental_SendQueueHighWaterMarkEvent cEvent;
+            SilKit_Struct_Init(SilKit_Experimental_SendQueueHighWaterMarkEvent, cEvent);
+            cEvent.participantName = cppEvent.participantName.c_str();
+            cEvent.isAboveHighWaterMark = cppEvent.isAboveHighWaterMark ? SilKit_True : SilKit_False;
+            cEvent.queuedMessages = cppEvent.queuedMessages;
+            cEvent.queuedBytes = cppEvent.queuedBytes;
+            cEvent.numDroppedMessages = cppEvent.numDroppedMessages;
+
+            handler(context, participant, &cEvent);
+        });
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetTrafficStatistics(
+    SilKit_Participant* participant, void* context, SilKit_Experimental_PeerTrafficStatisticsHandler_t peerHandler,
+    SilKit_Experimental_LinkTrafficStatisticsHandler_t linkHandler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+
+    auto cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    const auto trafficStatistics = SilKit::Experimental::Participant::GetTrafficStatisticsImpl(cppParticipant);
+
+    if (peerHandler != nullptr)
+    {
+        for (const auto& peer : trafficStatistics.peers)
+        {
+            SilKit_Experimental_PeerTrafficStatistics cStatistics;
+            SilKit_Struct_Init(SilKit_Experimental_PeerTrafficStatistics, cStatistics);
+            cStatistics.participantName = peer.participantName.c_str();
+            cStatistics.numSentMessages = peer.numSentMessages;
+            cStatistics.numSentBytes = peer.numSentBytes;
+            cStatistics.numWrites = peer.numWrites;
+            cStatistics.maxQueuedMessages = peer.maxQueuedMessages;
+            cStatistics.maxQueuedBytes = peer.maxQueuedBytes;
+            cStatistics.numReceivedMessages = peer.numReceivedMessages;
+            cStatistics.numReceivedBytes = peer.numReceivedBytes;
+
+            peerHandler(context, participant, &cStatistics);
+        }
+    }
+
+    if (linkHandler != nullptr)
+    {
+        for (const auto& link : trafficStatistics.links)
+        {
+            SilKit_Experimental_LinkTrafficStatistics cStatistics;
+            SilKit_Struct_Init(SilKit_Experimental_LinkTrafficStatistics, cStatistics);
+            cStatistics.networkName = link.networkName.c_str();
+            cStatistics.messageTypeName = link.messageTypeName.c_str();
+            cStatistics.numSentMessages = link.numSentMessages;
+            cStatistics.numReceivedMessages = link.numReceivedMessages;
+
+            linkHandler(context, participant, &cStatistics);
+        }
+    }
+
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
     SilKit_ParticipantConfiguration** outParticipantConfiguration,
     const char* participantConfigurationString)
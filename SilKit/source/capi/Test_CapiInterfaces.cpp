@@ -79,6 +79,9 @@ constexpr uint64_t allSilkidIds[]= {
     SilKit_RpcCallResultEvent_STRUCT_VERSION,
     SilKit_ParticipantStatus_STRUCT_VERSION,
     SilKit_LifecycleConfiguration_STRUCT_VERSION,
+    SilKit_Experimental_SendQueueHighWaterMarkEvent_STRUCT_VERSION,
+    SilKit_Experimental_PeerTrafficStatistics_STRUCT_VERSION,
+    SilKit_Experimental_LinkTrafficStatistics_STRUCT_VERSION,
 };
 constexpr auto allSilkidIdsSize = sizeof(allSilkidIds) / sizeof(uint64_t);
 
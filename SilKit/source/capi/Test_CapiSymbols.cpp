@@ -140,6 +140,10 @@ SilKit_HandlerId id;
 (void) SilKit_RpcClient_SetCallResultHandler(nullptr, nullptr, nullptr);
 (void) SilKit_ReturnCodeToString(nullptr, SilKit_ReturnCode_BADPARAMETER);
 (void) SilKit_Participant_GetLogger(nullptr, nullptr);
+(void) SilKit_Experimental_Participant_BeginServiceRegistrationBatch(nullptr);
+(void) SilKit_Experimental_Participant_EndServiceRegistrationBatch(nullptr);
+(void) SilKit_Experimental_Participant_SetSendQueueHighWaterMarkHandler(nullptr, nullptr, nullptr);
+(void) SilKit_Experimental_Participant_GetTrafficStatistics(nullptr, nullptr, nullptr, nullptr);
 (void)SilKit_GetLastErrorString();
 }
 
@@ -219,8 +219,18 @@ struct Extensions
 
 struct Middleware
 {
+    //! How a peer handles service messages that do not fit into its sending queue anymore
+    enum class SendQueueOverflowPolicy : uint8_t
+    {
+        Block, //!< Wait until enough queued messages were written
+        DropOldest, //!< Queue the message and drop the oldest queued frames of CAN and Ethernet controllers
+        Error //!< Throw a SilKitError to the sending service
+    };
+
     std::string registryUri{}; //!< Registry URI to connect to (configuration has priority)
     int connectAttempts{ 1 }; //!<  Number of connection attempts to the registry a participant should perform.
+    //! Time to connect to the registry, and to connect to and complete the handshake with all known participants.
+    double connectTimeoutSeconds{ 5.0 };
     int tcpReceiveBufferSize{ -1 };
     int tcpSendBufferSize{ -1 };
     bool tcpNoDelay{ false }; //!< Disables Nagle's algorithm.
@@ -229,6 +239,32 @@ struct Middleware
     std::vector<std::string> acceptorUris{}; //!< Explicit list of endpoints this participant will accept connections on.
     //! By default, communication with other participants using the registry as a proxy is enabled.
     bool registryAsFallbackProxy{ true };
+    //! Maximum number of bytes of queued messages that are combined into a single gathering socket write.
+    //! Batching of socket writes is disabled if this value is not positive.
+    int batchedWriteMaxBytes{ -1 };
+    //! Maximum number of buffers combined into a single gathering socket write, if batching is enabled.
+    int batchedWriteMaxBuffers{ 64 };
+    //! Number of threads processing the network IO of the participant. Each peer connection is served by one thread
+    //! at a time, while messages are still delivered to the services one after another.
+    int ioWorkerThreads{ 1 };
+    //! Exchange messages with participants on the same host via shared memory, if both participants enable it.
+    //! Local domain sockets are still used for the handshake and for waking up the remote participant.
+    bool enableSharedMemory{ false };
+    //! Hold back the messages sent during a simulation step and write them per peer at the end of the step.
+    bool enableMessageCoalescing{ false };
+    //! Write the held back messages of a peer before the end of the simulation step, once they exceed this size.
+    int messageCoalescingMaxBytes{ 64 * 1024 };
+    //! Write the messages of the time synchronization and lifecycle ahead of queued data messages.
+    bool prioritizeControlMessages{ false };
+    //! Connect to other participants only once a service sends them its first message. The handshake and the
+    //! subscriptions are always relayed by the registry, all other messages until the connection is opened.
+    bool enableLazyPeerConnections{ false };
+    //! Maximum number of bytes queued for sending to a single peer. The queue is unbounded if not positive.
+    int sendQueueMaxBytes{ -1 };
+    //! Maximum number of messages queued for sending to a single peer. The queue is unbounded if not positive.
+    int sendQueueMaxMessages{ -1 };
+    //! What happens to service messages sent while the sending queue to a peer is full
+    SendQueueOverflowPolicy sendQueueOverflowPolicy{ SendQueueOverflowPolicy::Block };
 };
 
 // ================================================================================
@@ -140,9 +140,21 @@ bool operator==(const Extensions& lhs, const Extensions& rhs)
 bool operator==(const Middleware& lhs, const Middleware& rhs)
 {
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
+           && lhs.connectTimeoutSeconds == rhs.connectTimeoutSeconds
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.batchedWriteMaxBytes == rhs.batchedWriteMaxBytes
+           && lhs.batchedWriteMaxBuffers == rhs.batchedWriteMaxBuffers
+           && lhs.ioWorkerThreads == rhs.ioWorkerThreads
+           && lhs.enableSharedMemory == rhs.enableSharedMemory
+           && lhs.enableMessageCoalescing == rhs.enableMessageCoalescing
+           && lhs.messageCoalescingMaxBytes == rhs.messageCoalescingMaxBytes
+           && lhs.prioritizeControlMessages == rhs.prioritizeControlMessages
+           && lhs.enableLazyPeerConnections == rhs.enableLazyPeerConnections
+           && lhs.sendQueueMaxBytes == rhs.sendQueueMaxBytes
+           && lhs.sendQueueMaxMessages == rhs.sendQueueMaxMessages
+           && lhs.sendQueueOverflowPolicy == rhs.sendQueueOverflowPolicy;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -362,7 +362,9 @@ TEST_F(YamlParserTest, middleware_convert)
             "TcpSendBufferSize": 3456,
             "TcpReceiveBufferSize": 3456,
             "EnableDomainSockets": false,
-            "RegistryAsFallbackProxy": false
+            "RegistryAsFallbackProxy": false,
+            "SendQueueMaxBytes": 65536,
+            "SendQueueOverflowPolicy": "DropOldest"
         }
     )");
     auto config = node.as<Middleware>();
@@ -375,6 +377,9 @@ TEST_F(YamlParserTest, middleware_convert)
     EXPECT_EQ(config.tcpSendBufferSize, 3456);
     EXPECT_EQ(config.tcpReceiveBufferSize, 3456);
     EXPECT_EQ(config.registryAsFallbackProxy, false);
+    EXPECT_EQ(config.sendQueueMaxBytes, 65536);
+    EXPECT_EQ(config.sendQueueMaxMessages, -1);
+    EXPECT_EQ(config.sendQueueOverflowPolicy, Middleware::SendQueueOverflowPolicy::DropOldest);
 }
 
 TEST_F(YamlParserTest, map_serdes)
@@ -943,6 +943,53 @@ bool Converter::decode(const Node& node, Extensions& obj)
 }
 
 
+template<>
+Node Converter::encode(const Middleware::SendQueueOverflowPolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case Middleware::SendQueueOverflowPolicy::Block:
+        node = "Block";
+        break;
+    case Middleware::SendQueueOverflowPolicy::DropOldest:
+        node = "DropOldest";
+        break;
+    case Middleware::SendQueueOverflowPolicy::Error:
+        node = "Error";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, Middleware::SendQueueOverflowPolicy& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "SendQueueOverflowPolicy should be a string of Block|DropOldest|Error.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::Block;
+    }
+    else if (str == "DropOldest")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::DropOldest;
+    }
+    else if (str == "Error")
+    {
+        obj = Middleware::SendQueueOverflowPolicy::Error;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown SendQueueOverflowPolicy: " + str + ".");
+    }
+    return true;
+}
+
 template<>
 Node Converter::encode(const Middleware& obj)
 {
@@ -950,6 +997,7 @@ Node Converter::encode(const Middleware& obj)
     static const Middleware defaultObj;
     non_default_encode(obj.registryUri, node, "RegistryUri", defaultObj.registryUri);
     non_default_encode(obj.connectAttempts, node, "ConnectAttempts", defaultObj.connectAttempts);
+    non_default_encode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
     non_default_encode(obj.tcpNoDelay, node, "TcpNoDelay", defaultObj.tcpNoDelay);
     non_default_encode(obj.tcpQuickAck, node, "TcpQuickAck", defaultObj.tcpQuickAck);
     non_default_encode(obj.tcpReceiveBufferSize, node, "TcpReceiveBufferSize", defaultObj.tcpReceiveBufferSize);
@@ -957,6 +1005,21 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.enableDomainSockets, node, "EnableDomainSockets", defaultObj.enableDomainSockets);
     non_default_encode(obj.acceptorUris, node, "acceptorUris", defaultObj.acceptorUris);
     non_default_encode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy", defaultObj.registryAsFallbackProxy);
+    non_default_encode(obj.batchedWriteMaxBytes, node, "BatchedWriteMaxBytes", defaultObj.batchedWriteMaxBytes);
+    non_default_encode(obj.batchedWriteMaxBuffers, node, "BatchedWriteMaxBuffers", defaultObj.batchedWriteMaxBuffers);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.enableMessageCoalescing, node, "EnableMessageCoalescing", defaultObj.enableMessageCoalescing);
+    non_default_encode(obj.messageCoalescingMaxBytes, node, "MessageCoalescingMaxBytes",
+                       defaultObj.messageCoalescingMaxBytes);
+    non_default_encode(obj.prioritizeControlMessages, node, "PrioritizeControlMessages",
+                       defaultObj.prioritizeControlMessages);
+    non_default_encode(obj.enableLazyPeerConnections, node, "EnableLazyPeerConnections",
+                       defaultObj.enableLazyPeerConnections);
+    non_default_encode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes", defaultObj.sendQueueMaxBytes);
+    non_default_encode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages", defaultObj.sendQueueMaxMessages);
+    non_default_encode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy",
+                       defaultObj.sendQueueOverflowPolicy);
     return node;
 }
 template<>
@@ -964,6 +1027,7 @@ bool Converter::decode(const Node& node, Middleware& obj)
 {
     optional_decode(obj.registryUri, node, "RegistryUri");
     optional_decode(obj.connectAttempts, node, "ConnectAttempts");
+    optional_decode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds");
     optional_decode(obj.tcpNoDelay, node, "TcpNoDelay");
     optional_decode(obj.tcpQuickAck, node, "TcpQuickAck");
     optional_decode(obj.tcpReceiveBufferSize, node, "TcpReceiveBufferSize");
@@ -971,6 +1035,17 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.enableDomainSockets, node, "EnableDomainSockets");
     optional_decode(obj.acceptorUris, node, "AcceptorUris");
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
+    optional_decode(obj.batchedWriteMaxBytes, node, "BatchedWriteMaxBytes");
+    optional_decode(obj.batchedWriteMaxBuffers, node, "BatchedWriteMaxBuffers");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.enableMessageCoalescing, node, "EnableMessageCoalescing");
+    optional_decode(obj.messageCoalescingMaxBytes, node, "MessageCoalescingMaxBytes");
+    optional_decode(obj.prioritizeControlMessages, node, "PrioritizeControlMessages");
+    optional_decode(obj.enableLazyPeerConnections, node, "EnableLazyPeerConnections");
+    optional_decode(obj.sendQueueMaxBytes, node, "SendQueueMaxBytes");
+    optional_decode(obj.sendQueueMaxMessages, node, "SendQueueMaxMessages");
+    optional_decode(obj.sendQueueOverflowPolicy, node, "SendQueueOverflowPolicy");
     return true;
 }
 
@@ -76,6 +76,7 @@ DEFINE_SILKIT_CONVERT(TraceSink::Type);
 DEFINE_SILKIT_CONVERT(TraceSource);
 DEFINE_SILKIT_CONVERT(TraceSource::Type);
 
+DEFINE_SILKIT_CONVERT(Middleware::SendQueueOverflowPolicy);
 DEFINE_SILKIT_CONVERT(Middleware);
 
 DEFINE_SILKIT_CONVERT(Extensions);
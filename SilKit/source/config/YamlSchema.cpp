@@ -219,12 +219,24 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {"Middleware", {
                 {"RegistryUri"},
                 {"ConnectAttempts"},
+                {"ConnectTimeoutSeconds"},
                 {"TcpNoDelay"},
                 {"TcpQuickAck"},
                 {"TcpReceiveBufferSize"},
                 {"TcpSendBufferSize"},
                 {"EnableDomainSockets"},
-                {"AcceptorUris"}
+                {"AcceptorUris"},
+                {"BatchedWriteMaxBytes"},
+                {"BatchedWriteMaxBuffers"},
+                {"IoWorkerThreads"},
+                {"EnableSharedMemory"},
+                {"EnableMessageCoalescing"},
+                {"MessageCoalescingMaxBytes"},
+                {"PrioritizeControlMessages"},
+                {"EnableLazyPeerConnections"},
+                {"SendQueueMaxBytes"},
+                {"SendQueueMaxMessages"},
+                {"SendQueueOverflowPolicy"}
             }
         }
     };
@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "internal_fwd.hpp"
 #include "IServiceEndpoint.hpp"
@@ -178,6 +179,8 @@ public:
 
     // For Connection/middleware support:
     virtual void OnAllMessagesDelivered(std::function<void()> callback) = 0;
+    //! Hold back messages to remote participants until FlushSendBuffers is called, if enabled in the configuration
+    virtual void StartSendBuffering() = 0;
     virtual void FlushSendBuffers() = 0;
     virtual void ExecuteDeferred(std::function<void()> callback) = 0;
 
@@ -220,6 +223,16 @@ public:
 
     // Register handlers for completion of async service creation
     virtual void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) = 0;
+
+    //! Services created until EndServiceRegistrationBatch are registered at the other participants in a single round
+    virtual void BeginServiceRegistrationBatch() = 0;
+    virtual void EndServiceRegistrationBatch() = 0;
+
+    //! Called whenever the sending queue to a remote participant reaches its limit, or drained to half of it again
+    virtual void SetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler) = 0;
+    //! The messages and bytes exchanged per remote participant, and the messages per network and message type
+    virtual auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics = 0;
     
     virtual bool GetIsSystemControllerCreated() = 0;
     virtual void SetIsSystemControllerCreated(bool isCreated) = 0;
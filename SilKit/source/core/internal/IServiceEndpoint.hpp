@@ -50,7 +50,8 @@ public:
 
 inline bool AllowMessageProcessing(const ServiceDescriptor& lhs, const ServiceDescriptor& rhs)
 {
-    return lhs.GetServiceId() == rhs.GetServiceId() && lhs.GetParticipantName() == rhs.GetParticipantName();
+    return lhs.GetServiceId() == rhs.GetServiceId()
+           && lhs.GetInternedParticipantName() == rhs.GetInternedParticipantName();
 }
 
 inline EndpointAddress to_endpointAddress(const ServiceDescriptor& descriptor)
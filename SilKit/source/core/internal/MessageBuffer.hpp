@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstring>
 #include <stdexcept>
 #include <map>
+#include <memory>
 
 #include "silkit/util/Span.hpp"
 
@@ -67,11 +68,17 @@ public:
     // ----------------------------------------
     // Public Data Types
 
+    //! Selects a buffer which only counts the bytes that would be written, see SerializedSize
+    struct ComputeSizeOnly
+    {
+    };
+
 public:
     // ----------------------------------------
     // Constructors and Destructor
     inline MessageBuffer() = default;
     inline MessageBuffer(std::vector<uint8_t> data);
+    inline explicit MessageBuffer(ComputeSizeOnly);
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
@@ -103,6 +110,13 @@ public:
     //! \brief Return the underlying data storage by std::move and reset pointers
     inline auto ReleaseStorage() -> std::vector<uint8_t>;
     inline auto RemainingBytesLeft() const noexcept -> size_t;
+    //! \brief The number of bytes written so far, or counted by a ComputeSizeOnly buffer
+    inline auto WritePos() const -> size_t;
+    //! \brief Allocate the storage for the given total number of bytes up front
+    inline void Reserve(size_t numBytes);
+    //! \brief Move the storage into the given holder, once a deserialized payload references it.
+    //! The holder is recycled by its owner as soon as no payload references it anymore.
+    inline void SetSharedStorageHolder(std::shared_ptr<std::vector<uint8_t>> holder);
 public:
     // ----------------------------------------
     // Elementary streaming operators
@@ -112,23 +126,20 @@ public:
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
-        if (_wPos + sizeof(IntegerT) > _storage.size())
+        if (auto* data = AppendBytes(sizeof(IntegerT)))
         {
-            _storage.resize(_storage.size() + sizeof(IntegerT));
+            std::memcpy(data, &t, sizeof(IntegerT));
         }
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(IntegerT));
-
-        _wPos += sizeof(IntegerT);
 
         return *this;
     }
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        if (_rPos + sizeof(IntegerT) > Storage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, Storage().data() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -141,14 +152,11 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_wPos + sizeof(DoubleT) > _storage.size())
+        if (auto* data = AppendBytes(sizeof(DoubleT)))
         {
-            _storage.resize(_storage.size() + sizeof(DoubleT));
+            std::memcpy(data, &t, sizeof(DoubleT));
         }
 
-        std::memcpy(_storage.data() + _wPos, &t, sizeof(DoubleT));
-        _wPos += sizeof(DoubleT);
-
         return *this;
     }
     template<typename DoubleT, typename std::enable_if_t<std::is_floating_point<DoubleT>::value, int> = 0>
@@ -156,10 +164,10 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        if (_rPos + sizeof(DoubleT) > Storage().size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, Storage().data() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -201,8 +209,13 @@ public:
     // Util::SharedVector<T>
     template <typename ValueT>
     inline MessageBuffer& operator<<(const Util::SharedVector<ValueT>& sharedData);
+    //! Same wire format as the generic overload, but the bytes are copied at once
+    inline MessageBuffer& operator<<(const Util::SharedVector<uint8_t>& sharedData);
     template <typename ValueT>
     inline MessageBuffer& operator>>(Util::SharedVector<ValueT>& sharedData);
+    //! The deserialized bytes reference the storage of this buffer, which is shared with the payload. Small payloads
+    //! are copied into the inline storage of the SharedVector instead.
+    inline MessageBuffer& operator>>(Util::SharedVector<uint8_t>& sharedData);
     // --------------------------------------------------------------------------------
     // std::array<uint8_t, SIZE>
     template<size_t SIZE>
@@ -241,13 +254,25 @@ public:
     inline MessageBuffer& operator>>(Util::Uuid& uuid);
 
 
+private:
+    // ----------------------------------------
+    // private methods
+    inline auto Storage() -> std::vector<uint8_t>&;
+    inline auto Storage() const -> const std::vector<uint8_t>&;
+    //! Advance the write position by numBytes and return where to write them, nullptr if only computing the size
+    inline auto AppendBytes(size_t numBytes) -> uint8_t*;
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    // The storage is moved here when a payload references it, see operator>>(Util::SharedVector<uint8_t>&)
+    std::shared_ptr<std::vector<uint8_t>> _sharedStorage;
+    std::shared_ptr<std::vector<uint8_t>> _sharedStorageHolder;
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
+    bool _computeSizeOnly{false};
 };
 
 // ================================================================================
@@ -260,16 +285,78 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(ComputeSizeOnly)
+    : _computeSizeOnly{true}
+{
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
     _wPos = 0u;
     _rPos = 0u;
+    _sharedStorageHolder.reset();
+    if (_sharedStorage)
+    {
+        auto sharedStorage = std::move(_sharedStorage);
+        // the storage can only be handed out, once no deserialized payload references it anymore
+        if (sharedStorage.use_count() == 1)
+        {
+            return std::move(*sharedStorage);
+        }
+        return {};
+    }
     return std::move(_storage);
 }
 
+auto MessageBuffer::Storage() -> std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
+auto MessageBuffer::Storage() const -> const std::vector<uint8_t>&
+{
+    return _sharedStorage ? *_sharedStorage : _storage;
+}
+
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    return (_rPos > Storage().size()) ? 0 : (Storage().size() - _rPos);
+}
+
+auto MessageBuffer::WritePos() const -> size_t
+{
+    return _wPos;
+}
+
+void MessageBuffer::Reserve(size_t numBytes)
+{
+    if (!_computeSizeOnly)
+    {
+        Storage().reserve(numBytes);
+    }
+}
+
+void MessageBuffer::SetSharedStorageHolder(std::shared_ptr<std::vector<uint8_t>> holder)
+{
+    _sharedStorageHolder = std::move(holder);
+}
+
+auto MessageBuffer::AppendBytes(size_t numBytes) -> uint8_t*
+{
+    const auto writePos = _wPos;
+    _wPos += numBytes;
+
+    if (_computeSizeOnly)
+    {
+        return nullptr;
+    }
+
+    // does not reallocate if the storage was reserved with the exact size beforehand
+    if (_wPos > Storage().size())
+    {
+        Storage().resize(_wPos);
+    }
+    return Storage().data() + writePos;
 }
 
 // --------------------------------------------------------------------------------
@@ -281,14 +368,11 @@ MessageBuffer& MessageBuffer::operator<<(const std::string& str)
 
     *this << static_cast<uint32_t>(str.length());
 
-    if (_wPos + str.size() > _storage.size())
+    if (auto* data = AppendBytes(str.size()))
     {
-        _storage.resize(_wPos + str.size());
+        std::copy(str.begin(), str.end(), data);
     }
 
-    std::copy(str.begin(), str.end(), _storage.begin() + _wPos);
-    _wPos += str.size();
-
     return *this;
 }
 MessageBuffer& MessageBuffer::operator>>(std::string& str)
@@ -296,10 +380,10 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    if (_rPos + strLength > Storage().size())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    str = std::string(Storage().begin() + _rPos, Storage().begin() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -314,14 +398,11 @@ MessageBuffer& MessageBuffer::operator<<(const std::vector<uint8_t>& vector)
 
     *this << static_cast<uint32_t>(vector.size());
 
-    if (_wPos + vector.size() > _storage.size())
+    if (auto* data = AppendBytes(vector.size()))
     {
-        _storage.resize(_wPos + vector.size());
+        std::copy(vector.begin(), vector.end(), data);
     }
 
-    std::copy(vector.begin(), vector.end(), _storage.begin() + _wPos);
-    _wPos += vector.size();
-
     return *this;
 }
 MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
@@ -329,10 +410,10 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > Storage().size())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(Storage().begin() + _rPos, Storage().begin() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -359,7 +440,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > Storage().size())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -394,6 +475,25 @@ inline MessageBuffer& MessageBuffer::operator<<(const Util::SharedVector<ValueT>
     return *this;
 }
 
+MessageBuffer& MessageBuffer::operator<<(const Util::SharedVector<uint8_t>& sharedData)
+{
+    const auto span = sharedData.AsSpan();
+
+    if (span.size() > std::numeric_limits<uint32_t>::max())
+    {
+        throw end_of_buffer{};
+    }
+
+    *this << static_cast<uint32_t>(span.size());
+
+    if (auto* data = AppendBytes(span.size()))
+    {
+        std::copy(span.begin(), span.end(), data);
+    }
+
+    return *this;
+}
+
 template <typename ValueT>
 inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& sharedData)
 {
@@ -405,6 +505,42 @@ inline MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<ValueT>& shar
     return *this;
 }
 
+MessageBuffer& MessageBuffer::operator>>(Util::SharedVector<uint8_t>& sharedData)
+{
+    uint32_t vectorSize{0u};
+    *this >> vectorSize;
+
+    if (_rPos + vectorSize > Storage().size())
+        throw end_of_buffer{};
+
+    if (vectorSize <= Util::SharedVector<uint8_t>::InlineCapacity)
+    {
+        // small payloads are copied, so that the storage is not referenced and can be reused
+        sharedData = Util::SharedVector<uint8_t>{Util::Span<const uint8_t>{Storage().data() + _rPos, vectorSize}};
+        _rPos += vectorSize;
+        return *this;
+    }
+
+    if (!_sharedStorage)
+    {
+        if (_sharedStorageHolder)
+        {
+            *_sharedStorageHolder = std::move(_storage);
+            _sharedStorage = std::move(_sharedStorageHolder);
+        }
+        else
+        {
+            _sharedStorage = std::make_shared<std::vector<uint8_t>>(std::move(_storage));
+        }
+    }
+
+    sharedData = Util::SharedVector<uint8_t>{
+        std::shared_ptr<const uint8_t>{_sharedStorage, _sharedStorage->data() + _rPos}, vectorSize};
+    _rPos += vectorSize;
+
+    return *this;
+}
+
 // --------------------------------------------------------------------------------
 // std::array<uint8_t, SIZE>
 template<size_t SIZE>
@@ -413,23 +549,20 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
-    if (_wPos + array.size() > _storage.size())
+    if (auto* data = AppendBytes(array.size()))
     {
-        _storage.resize(_wPos + array.size());
+        std::copy(array.begin(), array.end(), data);
     }
 
-    std::copy(array.begin(), array.end(), _storage.begin() + _wPos);
-    _wPos += array.size();
-
     return *this;
 }
 template<size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > Storage().size())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(Storage().begin() + _rPos, Storage().begin() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -451,7 +584,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template<typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > Storage().size())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -584,7 +717,7 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const  -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return Storage();
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
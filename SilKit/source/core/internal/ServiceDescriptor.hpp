@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "Configuration.hpp"
 #include "EndpointAddress.hpp"
 #include "Hash.hpp"
+#include "InternedString.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -70,6 +71,8 @@ public:
     inline auto GetParticipantId() const -> ParticipantId;
     inline void SetParticipantId(ParticipantId id);
     inline auto GetParticipantName() const -> const std::string&;
+    //! \brief Handle of the participant name, for comparisons on hot paths
+    inline auto GetInternedParticipantName() const -> const Util::InternedString&;
     //! \brief Setting the participant name will also set the participant ID to a computed value.
     inline void SetParticipantNameAndComputeId(std::string val);
 
@@ -77,12 +80,14 @@ public:
     inline void SetServiceType(SilKit::Core::ServiceType val);
 
     inline auto GetNetworkName() const -> const std::string&;
+    inline auto GetInternedNetworkName() const -> const Util::InternedString&;
     inline void SetNetworkName(std::string val);
 
     inline auto GetNetworkType() const -> SilKit::Config::NetworkType;
     inline void SetNetworkType(SilKit::Config::NetworkType val);
 
     inline auto GetServiceName() const -> const std::string&;
+    inline auto GetInternedServiceName() const -> const Util::InternedString&;
     inline void SetServiceName(std::string val);
 
     inline auto GetServiceId() const -> SilKit::Core::EndpointId ;
@@ -109,12 +114,13 @@ private:
     friend auto operator>>(SilKit::Core::MessageBuffer& buffer,
             SilKit::Core::ServiceDescriptor& updatedMsg) -> SilKit::Core::MessageBuffer&;
 private:
-    std::string _participantName; //!< name of the participant
+    // the names are interned, so that copying and comparing descriptors does not touch the strings
+    Util::InternedString _participantName; //!< name of the participant
     ParticipantId _participantId{0};
     ServiceType _serviceType{ServiceType::Undefined};
-    std::string _networkName; //!< the service's link name
+    Util::InternedString _networkName; //!< the service's link name
     SilKit::Config::NetworkType _networkType{SilKit::Config::NetworkType::Invalid};
-    std::string _serviceName;
+    Util::InternedString _serviceName;
     EndpointId _serviceId{0};
     SupplementalData _supplementalData;
 };
@@ -150,14 +156,20 @@ void ServiceDescriptor::SetParticipantId(ParticipantId id)
 }
 
 auto ServiceDescriptor::GetParticipantName() const -> const std::string&
+{
+    return _participantName.Str();
+}
+
+auto ServiceDescriptor::GetInternedParticipantName() const -> const Util::InternedString&
 {
     return _participantName;
 }
 
 void ServiceDescriptor::SetParticipantNameAndComputeId(std::string val) 
 {
-    _participantId = SilKit::Util::Hash::Hash(val);
-    _participantName = std::move(val);
+    // the hash of the name is computed once, when it is interned
+    _participantName = Util::InternedString{val};
+    _participantId = _participantName.Hash();
 }
 
 auto ServiceDescriptor::GetServiceType() const -> SilKit::Core::ServiceType
@@ -171,13 +183,18 @@ void ServiceDescriptor::SetServiceType(SilKit::Core::ServiceType val)
 }
 
 auto ServiceDescriptor::GetNetworkName() const -> const std::string&
+{
+    return _networkName.Str();
+}
+
+auto ServiceDescriptor::GetInternedNetworkName() const -> const Util::InternedString&
 {
     return _networkName;
 }
 
 void ServiceDescriptor::SetNetworkName(std::string val)
 {
-    _networkName = std::move(val);
+    _networkName = Util::InternedString{val};
 }
 
 auto ServiceDescriptor::GetNetworkType() const -> SilKit::Config::NetworkType 
@@ -191,13 +208,18 @@ void ServiceDescriptor::SetNetworkType(SilKit::Config::NetworkType val)
 }
 
 auto ServiceDescriptor::GetServiceName() const -> const std::string&
+{
+    return _serviceName.Str();
+}
+
+auto ServiceDescriptor::GetInternedServiceName() const -> const Util::InternedString&
 {
     return _serviceName;
 }
 
 void ServiceDescriptor::SetServiceName(std::string val)
 {
-    _serviceName = std::move(val);
+    _serviceName = Util::InternedString{val};
 }
 
 auto ServiceDescriptor::GetServiceId() const -> SilKit::Core::EndpointId 
@@ -235,7 +257,7 @@ inline bool ServiceDescriptor::operator==(const ServiceDescriptor& rhs) const
 {
     return 
         GetParticipantId() == rhs.GetParticipantId()
-        && GetNetworkName() == rhs.GetNetworkName() 
+        && GetInternedNetworkName() == rhs.GetInternedNetworkName() 
         && GetServiceType() == rhs.GetServiceType() 
         && GetServiceId() == rhs.GetServiceId()
         ;
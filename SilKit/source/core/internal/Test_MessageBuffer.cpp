@@ -137,6 +137,108 @@ TEST(MwVAsio_MessageBuffer, std_vector_uint8_t)
     EXPECT_EQ(in, out);
 }
 
+TEST(MwVAsio_MessageBuffer, shared_vector_uint8_t_references_buffer_storage)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::vector<uint8_t> in(9000, 'x');
+    buffer << uint32_t{42} << SilKit::Util::SharedVector<uint8_t>{in} << std::string{"trailer"};
+
+    SilKit::Core::MessageBuffer receiveBuffer{buffer.ReleaseStorage()};
+    const auto* storageBegin = receiveBuffer.PeekData().data();
+    const auto storageEnd = storageBegin + receiveBuffer.PeekData().size();
+
+    uint32_t header{0};
+    SilKit::Util::SharedVector<uint8_t> out;
+    std::string trailer;
+    receiveBuffer >> header >> out >> trailer;
+
+    EXPECT_EQ(header, 42u);
+    EXPECT_EQ(trailer, "trailer");
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.AsSpan(), SilKit::Util::ToSpan(in)));
+    // the payload was not copied out of the buffer
+    EXPECT_GE(out.AsSpan().data(), storageBegin);
+    EXPECT_LT(out.AsSpan().data(), storageEnd);
+
+    // the storage is kept alive by the payload, and not handed out while it is referenced
+    EXPECT_TRUE(receiveBuffer.ReleaseStorage().empty());
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.AsSpan(), SilKit::Util::ToSpan(in)));
+}
+
+TEST(MwVAsio_MessageBuffer, shared_vector_uint8_t_storage_is_released_without_references)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    buffer << SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(100, 'x')};
+    const auto size = buffer.PeekData().size();
+
+    SilKit::Core::MessageBuffer receiveBuffer{buffer.ReleaseStorage()};
+    {
+        SilKit::Util::SharedVector<uint8_t> out;
+        receiveBuffer >> out;
+        EXPECT_EQ(out.AsSpan().size(), 100u);
+    }
+
+    EXPECT_EQ(receiveBuffer.ReleaseStorage().size(), size);
+}
+
+TEST(MwVAsio_MessageBuffer, shared_vector_uint8_t_copies_small_payloads)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::vector<uint8_t> in{1, 2, 3, 4, 5, 6, 7, 8};
+    buffer << SilKit::Util::SharedVector<uint8_t>{in};
+    const auto size = buffer.PeekData().size();
+
+    SilKit::Core::MessageBuffer receiveBuffer{buffer.ReleaseStorage()};
+    SilKit::Util::SharedVector<uint8_t> out;
+    receiveBuffer >> out;
+
+    EXPECT_TRUE(out.IsInline());
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.AsSpan(), SilKit::Util::ToSpan(in)));
+    // the storage is not referenced by the payload, and can be reused right away
+    EXPECT_EQ(receiveBuffer.ReleaseStorage().size(), size);
+}
+
+TEST(MwVAsio_MessageBuffer, shared_vector_uint8_t_moves_large_payloads_into_the_holder)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    std::vector<uint8_t> in(1000, 42);
+    buffer << SilKit::Util::SharedVector<uint8_t>{in};
+
+    auto holder = std::make_shared<std::vector<uint8_t>>();
+    SilKit::Core::MessageBuffer receiveBuffer{buffer.ReleaseStorage()};
+    receiveBuffer.SetSharedStorageHolder(holder);
+    SilKit::Util::SharedVector<uint8_t> out;
+    receiveBuffer >> out;
+
+    EXPECT_FALSE(out.IsInline());
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.AsSpan(), SilKit::Util::ToSpan(in)));
+    // the payload references the storage inside of the holder
+    ASSERT_FALSE(holder->empty());
+    EXPECT_EQ(out.AsSpan().data(), holder->data() + sizeof(uint32_t));
+
+    // the storage stays with the holder, until the payload is dropped
+    EXPECT_TRUE(receiveBuffer.ReleaseStorage().empty());
+    EXPECT_GT(holder.use_count(), 1);
+    out = SilKit::Util::SharedVector<uint8_t>{};
+    EXPECT_EQ(holder.use_count(), 1);
+}
+
+TEST(MwVAsio_MessageBuffer, shared_vector_uint8_t_has_the_wire_format_of_std_vector)
+{
+    std::vector<uint8_t> in{1, 2, 3, 4, 5};
+
+    SilKit::Core::MessageBuffer sharedVectorBuffer;
+    sharedVectorBuffer << SilKit::Util::SharedVector<uint8_t>{in};
+
+    SilKit::Core::MessageBuffer vectorBuffer;
+    vectorBuffer << in;
+
+    EXPECT_EQ(sharedVectorBuffer.ReleaseStorage(), vectorBuffer.ReleaseStorage());
+}
+
 TEST(MwVAsio_MessageBuffer, std_vector_string)
 {
     SilKit::Core::MessageBuffer buffer;
@@ -236,3 +338,21 @@ TEST(MwVAsio_MessageBuffer, mixed_types)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(MwVAsio_MessageBuffer, compute_size_only_counts_the_written_bytes)
+{
+    SilKit::Core::MessageBuffer buffer;
+    SilKit::Core::MessageBuffer sizeBuffer{SilKit::Core::MessageBuffer::ComputeSizeOnly{}};
+
+    TestData in{3.333, std::numeric_limits<uint32_t>::max() - 1, -13, TestEnumT::A, 17ns, "This looks nice!"};
+    const std::vector<std::string> strings{"a", "bc", "def"};
+    const SilKit::Util::SharedVector<uint8_t> payload{std::vector<uint8_t>(100, 'x')};
+    const std::map<std::string, std::string> map{{"key", "value"}};
+
+    buffer << in.doub << in.ui32 << in.i16 << in.e << in.duration << in.str << strings << payload << map;
+    sizeBuffer << in.doub << in.ui32 << in.i16 << in.e << in.duration << in.str << strings << payload << map;
+
+    EXPECT_EQ(sizeBuffer.WritePos(), buffer.WritePos());
+    EXPECT_EQ(sizeBuffer.WritePos(), buffer.PeekData().size());
+    EXPECT_TRUE(sizeBuffer.ReleaseStorage().empty());
+}
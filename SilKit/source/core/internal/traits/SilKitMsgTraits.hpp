@@ -49,12 +49,18 @@ struct HasTimestamp<T, Util::VoidT<decltype(std::declval<std::decay_t<T>>().time
 template <class MsgT> struct SilKitMsgTraitTypeName { static constexpr const char *TypeName(); };
 template <class MsgT> struct SilKitMsgTraitHistSize { static constexpr std::size_t HistSize() { return 0; } };
 template <class MsgT> struct SilKitMsgTraitEnforceSelfDelivery { static constexpr bool IsSelfDeliveryEnforced() { return false; } };
+template <class MsgT> struct SilKitMsgTraitIsControlMsg { static constexpr bool IsControlMsg() { return false; } };
+template <class MsgT> struct SilKitMsgTraitIsBroadcastMsg { static constexpr bool IsBroadcastMsg() { return false; } };
+template <class MsgT> struct SilKitMsgTraitIsDroppableMsg { static constexpr bool IsDroppableMsg() { return false; } };
 
 // The final message traits
 template <class MsgT> struct SilKitMsgTraits
     : SilKitMsgTraitTypeName<MsgT>
     , SilKitMsgTraitHistSize<MsgT>
     , SilKitMsgTraitEnforceSelfDelivery<MsgT>
+    , SilKitMsgTraitIsControlMsg<MsgT>
+    , SilKitMsgTraitIsBroadcastMsg<MsgT>
+    , SilKitMsgTraitIsDroppableMsg<MsgT>
     , SilKitMsgTraitVersion<MsgT>
     , SilKitMsgTraitSerdesName<MsgT>
 {
@@ -69,6 +75,15 @@ template <class MsgT> struct SilKitMsgTraits
 #define DefineSilKitMsgTrait_EnforceSelfDelivery(Namespace, MsgName) template<> struct SilKitMsgTraitEnforceSelfDelivery<Namespace::MsgName>{\
     static constexpr bool IsSelfDeliveryEnforced() { return true; }\
     };
+#define DefineSilKitMsgTrait_IsControlMsg(Namespace, MsgName) template<> struct SilKitMsgTraitIsControlMsg<Namespace::MsgName>{\
+    static constexpr bool IsControlMsg() { return true; }\
+    };
+#define DefineSilKitMsgTrait_IsBroadcastMsg(Namespace, MsgName) template<> struct SilKitMsgTraitIsBroadcastMsg<Namespace::MsgName>{\
+    static constexpr bool IsBroadcastMsg() { return true; }\
+    };
+#define DefineSilKitMsgTrait_IsDroppableMsg(Namespace, MsgName) template<> struct SilKitMsgTraitIsDroppableMsg<Namespace::MsgName>{\
+    static constexpr bool IsDroppableMsg() { return true; }\
+    };
 
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, SystemCommand)
@@ -121,5 +136,23 @@ DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Orchestration, Partic
 DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Orchestration, SystemCommand)
 DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Lin, LinSendFrameHeaderRequest)
 
+// Messages of the time synchronization and lifecycle, which may be sent ahead of queued data messages
+DefineSilKitMsgTrait_IsControlMsg(SilKit::Services::Orchestration, NextSimTask)
+DefineSilKitMsgTrait_IsControlMsg(SilKit::Services::Orchestration, SystemCommand)
+DefineSilKitMsgTrait_IsControlMsg(SilKit::Services::Orchestration, ParticipantStatus)
+
+// Messages every participant exchanges with all others, independently of the services it creates
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Core::Discovery, ParticipantDiscoveryEvent)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Core::Discovery, ServiceDiscoveryEvent)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Core::RequestReply, RequestReplyCall)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Core::RequestReply, RequestReplyCallReturn)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Services::Orchestration, ParticipantStatus)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Services::Orchestration, SystemCommand)
+DefineSilKitMsgTrait_IsBroadcastMsg(SilKit::Services::Orchestration, WorkflowConfiguration)
+
+// Frames of buses, which may be lost on a real bus as well, and may be dropped if the sending queue of a peer is full
+DefineSilKitMsgTrait_IsDroppableMsg(SilKit::Services::Can, WireCanFrameEvent)
+DefineSilKitMsgTrait_IsDroppableMsg(SilKit::Services::Ethernet, WireEthernetFrameEvent)
+
 } // namespace Core
 } // namespace SilKit
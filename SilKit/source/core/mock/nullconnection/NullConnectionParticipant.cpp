@@ -57,6 +57,7 @@ struct NullConnection
     void SendMsg(const Core::IServiceEndpoint* /*from*/, const std::string& /*target*/, SilKitMessageT&& /*msg*/) {}
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
+    void StartSendBuffering() {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
     void NotifyShutdown() {}
@@ -66,6 +67,15 @@ struct NullConnection
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/) {}
 
+    void BeginServiceRegistrationBatch() {}
+    void EndServiceRegistrationBatch() {}
+
+    void SetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler /*handler*/)
+    {
+    }
+    auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics { return {}; }
+
     size_t GetNumberOfConnectedParticipants() { return 0; }
 
     size_t GetNumberOfRemoteReceivers(const IServiceEndpoint* /*service*/, const std::string& /*msgTypeName*/)
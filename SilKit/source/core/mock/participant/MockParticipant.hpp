@@ -366,6 +366,7 @@ public:
 
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) override {}
+    void StartSendBuffering() override {}
     void FlushSendBuffers() override {}
     void ExecuteDeferred(std::function<void()> callback) override
     {
@@ -383,6 +384,15 @@ public:
     auto GetParticipantRepliesProcedure() -> RequestReply::IParticipantReplies* override { return &mockParticipantReplies; }
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override { handler(); };
+
+    void BeginServiceRegistrationBatch() override {}
+    void EndServiceRegistrationBatch() override {}
+
+    void SetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler /*handler*/) override
+    {
+    }
+    auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics override { return {}; }
     
     void SetIsSystemControllerCreated(bool /*isCreated*/) override{};
     bool GetIsSystemControllerCreated() override { return false; };
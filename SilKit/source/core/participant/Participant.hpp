@@ -273,11 +273,19 @@ public:
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const RequestReply::RequestReplyCallReturn& msg) override;
 
     void OnAllMessagesDelivered(std::function<void()> callback) override;
+    void StartSendBuffering() override;
     void FlushSendBuffers() override;
     void ExecuteDeferred(std::function<void()> callback) override;
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override;
 
+    void BeginServiceRegistrationBatch() override;
+    void EndServiceRegistrationBatch() override;
+
+    void SetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler) override;
+    auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics override;
+
     void SetIsSystemControllerCreated(bool isCreated) override;
     bool GetIsSystemControllerCreated() override;
 
@@ -1594,6 +1594,12 @@ void Participant<SilKitConnectionT>::OnAllMessagesDelivered(std::function<void()
     _connection.OnAllMessagesDelivered(std::move(callback));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::StartSendBuffering()
+{
+    _connection.StartSendBuffering();
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::FlushSendBuffers()
 {
@@ -1612,6 +1618,31 @@ void Participant<SilKitConnectionT>::SetAsyncSubscriptionsCompletionHandler(std:
     _connection.SetAsyncSubscriptionsCompletionHandler(std::move(handler));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::BeginServiceRegistrationBatch()
+{
+    _connection.BeginServiceRegistrationBatch();
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::EndServiceRegistrationBatch()
+{
+    _connection.EndServiceRegistrationBatch();
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SetSendQueueHighWaterMarkHandler(
+    SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler)
+{
+    _connection.SetSendQueueHighWaterMarkHandler(std::move(handler));
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics
+{
+    return _connection.GetTrafficStatistics();
+}
+
 template <class SilKitConnectionT>
 template <typename ValueT>
 void Participant<SilKitConnectionT>::LogMismatchBetweenConfigAndPassedValue(const std::string& canonicalName,
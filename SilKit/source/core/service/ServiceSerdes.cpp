@@ -31,11 +31,11 @@ inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buff
     const SilKit::Core::ServiceDescriptor& msg)
 {
     buffer
-        << msg._participantName
+        << msg._participantName.Str()
         << msg._serviceType
-        << msg._networkName
+        << msg._networkName.Str()
         << msg._networkType
-        << msg._serviceName
+        << msg._serviceName.Str()
         << msg._serviceId
         << msg._supplementalData
         << msg._participantId
@@ -46,16 +46,23 @@ inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buff
 inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
     SilKit::Core::ServiceDescriptor& updatedMsg)
 {
+    std::string participantName;
+    std::string networkName;
+    std::string serviceName;
     buffer
-        >> updatedMsg._participantName
+        >> participantName
         >> updatedMsg._serviceType
-        >> updatedMsg._networkName
+        >> networkName
         >> updatedMsg._networkType
-        >> updatedMsg._serviceName
+        >> serviceName
         >> updatedMsg._serviceId
         >> updatedMsg._supplementalData
         >> updatedMsg._participantId
         ;
+    // the transmitted participant id is kept, it is not recomputed from the name
+    updatedMsg._participantName = Util::InternedString{participantName};
+    updatedMsg._networkName = Util::InternedString{networkName};
+    updatedMsg._serviceName = Util::InternedString{serviceName};
     return buffer;
 }
 namespace Discovery {
@@ -58,3 +58,25 @@ TEST(MwVAsioSerdes, Mw_Service)
     EXPECT_EQ(out.services.at(9).GetSupplementalDataItem("Second", dummy), true);
 }
 
+TEST(MwVAsioSerdes, Mw_ServiceDescriptor_names_are_interned)
+{
+    SilKit::Core::MessageBuffer buffer;
+
+    SilKit::Core::Discovery::ParticipantDiscoveryEvent in{};
+    in.participantName = "Participant";
+    in.services.push_back(SilKit::Core::ServiceDescriptor{"Participant", "Link", "Service", 5});
+
+    SilKit::Core::Discovery::ParticipantDiscoveryEvent out{};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    const auto& inDescriptor = in.services.at(0);
+    const auto& outDescriptor = out.services.at(0);
+    EXPECT_EQ(inDescriptor, outDescriptor);
+    // the received names refer to the same interned strings
+    EXPECT_EQ(&outDescriptor.GetNetworkName(), &inDescriptor.GetNetworkName());
+    EXPECT_EQ(outDescriptor.GetInternedParticipantName(), inDescriptor.GetInternedParticipantName());
+    EXPECT_EQ(outDescriptor.GetInternedServiceName(), inDescriptor.GetInternedServiceName());
+    EXPECT_EQ(outDescriptor.GetParticipantId(), SilKit::Util::Hash::Hash("Participant"));
+}
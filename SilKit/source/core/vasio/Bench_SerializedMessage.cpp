@@ -0,0 +1,118 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SerializedMessage.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+namespace {
+
+auto MakeLogMsg(size_t payloadSize) -> SilKit::Services::Logging::LogMsg
+{
+    SilKit::Services::Logging::LogMsg logMsg;
+    logMsg.logger_name = "SerializedSizeTest";
+    logMsg.payload.assign(payloadSize, 'x');
+    return logMsg;
+}
+
+auto MakeDataMessageEvent(size_t payloadSize) -> SilKit::Services::PubSub::WireDataMessageEvent
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessageEvent{};
+    dataMessageEvent.timestamp = std::chrono::nanoseconds{1};
+    dataMessageEvent.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 'x')};
+    return dataMessageEvent;
+}
+
+auto MakeCanFrameEvent(size_t payloadSize) -> SilKit::Services::Can::WireCanFrameEvent
+{
+    SilKit::Services::Can::WireCanFrameEvent canFrameEvent{};
+    canFrameEvent.frame.canId = 3;
+    canFrameEvent.frame.dataField = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 'x')};
+    return canFrameEvent;
+}
+
+template <typename Function>
+auto MeasureSeconds(size_t numMessages, Function&& function) -> double
+{
+    size_t numBytes{0};
+    const auto begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < numMessages; ++i)
+    {
+        numBytes += function();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    // the serialized bytes are used, so that the loop is not optimized away
+    EXPECT_GT(numBytes, 0u);
+    return seconds;
+}
+
+//! Compares writing the message into a buffer which is reserved from SerializedSize up front, as done by
+//! SerializedMessage, with writing it into a buffer which grows on demand, as done before SerializedSize existed.
+template <typename MessageT>
+void PrintSerializationThroughput(const std::string& name, const MessageT& message, size_t numMessages)
+{
+    const auto numBytes = SerializedSize(message);
+
+    const auto reservedSeconds = MeasureSeconds(numMessages, [&message] {
+        MessageBuffer buffer;
+        buffer.Reserve(SerializedSize(message));
+        Serialize(buffer, message);
+        return buffer.ReleaseStorage().size();
+    });
+    const auto growingSeconds = MeasureSeconds(numMessages, [&message] {
+        MessageBuffer buffer;
+        Serialize(buffer, message);
+        return buffer.ReleaseStorage().size();
+    });
+
+    const auto toMiBPerSecond = [numBytes, numMessages](double seconds) {
+        return numBytes * numMessages / seconds / (1024.0 * 1024.0);
+    };
+    std::cout << name << ": " << toMiBPerSecond(reservedSeconds) << " MiB/s reserved, "
+              << toMiBPerSecond(growingSeconds) << " MiB/s growing, " << growingSeconds / reservedSeconds
+              << "x speedup of the size pass" << std::endl;
+}
+
+} // namespace
+
+TEST(VAsioSerializedMessageBenchmark, serialization_throughput_per_message_type)
+{
+    const size_t numMessages = 10000;
+
+    for (const size_t payloadSize : {size_t{8}, size_t{1024}, size_t{65536}})
+    {
+        const auto suffix = " (" + std::to_string(payloadSize) + " bytes payload)";
+        PrintSerializationThroughput("LogMsg" + suffix, MakeLogMsg(payloadSize), numMessages);
+        PrintSerializationThroughput("WireDataMessageEvent" + suffix, MakeDataMessageEvent(payloadSize), numMessages);
+        PrintSerializationThroughput("WireCanFrameEvent" + suffix, MakeCanFrameEvent(payloadSize), numMessages);
+    }
+
+    SilKit::Services::Orchestration::NextSimTask nextSimTask{std::chrono::nanoseconds{1}, std::chrono::nanoseconds{1}};
+    PrintSerializationThroughput("NextSimTask", nextSimTask, numMessages);
+}
@@ -0,0 +1,156 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioConnectionTestUtils.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+using namespace SilKit::Core::Tests;
+
+namespace {
+
+class VAsioConnectionBenchmark : public VAsioConnectionTest
+{
+protected:
+    template <typename Function>
+    static auto MeasureNanosecondsPerMessage(size_t numMessages, Function&& function) -> double
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < numMessages; ++i)
+        {
+            function(i);
+        }
+        const auto duration = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+               / numMessages;
+    }
+};
+
+} // namespace
+
+// Dispatching a message to the link of its sender, for a participant with many services. Services registered as
+// senders use their link handle, other endpoints look the link up by their network name.
+TEST_F(VAsioConnectionBenchmark, send_dispatch_per_message)
+{
+    constexpr size_t numServices = 64;
+    constexpr size_t numMessages = 100000;
+
+    std::vector<std::unique_ptr<TestServiceEndpoint>> services;
+    for (size_t i = 0; i < numServices; ++i)
+    {
+        services.emplace_back(std::make_unique<TestServiceEndpoint>(
+            "BenchmarkNetworkWithAQualifiedName/" + std::to_string(i), static_cast<EndpointId>(i)));
+        RegisterSilKitMsgSender<Tests::TestFrameEvent>(services.back().get());
+    }
+
+    const auto& registeredSender = *services.back();
+    const auto networkName = registeredSender.GetServiceDescriptor().GetNetworkName();
+    TestServiceEndpoint unregisteredSender{networkName, numServices};
+
+    CountingTestFrameEventReceiver receiver{networkName, numServices + 1};
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiver);
+
+    const Tests::TestFrameEvent msg{};
+    auto measure = [this, &msg](const IServiceEndpoint* sender) {
+        return MeasureNanosecondsPerMessage(numMessages, [this, sender, &msg](size_t) {
+            SendMsgImpl(sender, msg);
+        });
+    };
+
+    const auto nsPerMessageViaHandle = measure(&registeredSender);
+    const auto nsPerMessageViaName = measure(&unregisteredSender);
+
+    std::cout << "send dispatch via link handle: " << nsPerMessageViaHandle << " ns/message" << std::endl;
+    std::cout << "send dispatch via network name: " << nsPerMessageViaName << " ns/message" << std::endl;
+
+    EXPECT_EQ(receiver.numReceived, 2 * numMessages);
+}
+
+// Distributing a message of a local controller to many local controllers on the same network, e.g., a rest-bus
+// simulation hosting all CAN controllers in a single participant.
+TEST_F(VAsioConnectionBenchmark, local_fan_out_per_message)
+{
+    constexpr size_t numReceivers = 200;
+    constexpr size_t numMessages = 10000;
+
+    std::vector<std::unique_ptr<CountingTestFrameEventReceiver>> controllers;
+    for (size_t i = 0; i < numReceivers; ++i)
+    {
+        controllers.emplace_back(
+            std::make_unique<CountingTestFrameEventReceiver>("BenchmarkCanNetwork", static_cast<EndpointId>(i)));
+        RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(controllers.back().get());
+    }
+
+    const auto& sender = *controllers.front();
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    const Tests::TestFrameEvent msg{};
+    const auto nsPerMessage = MeasureNanosecondsPerMessage(numMessages, [this, &sender, &msg](size_t) {
+        SendMsgImpl(&sender, msg);
+    });
+
+    std::cout << "local fan-out to " << numReceivers << " receivers: " << nsPerMessage << " ns/message" << std::endl;
+
+    EXPECT_EQ(controllers.back()->numReceived, numMessages);
+}
+
+// The registry relaying messages between two participants, which can only reach each other through the registry. Only
+// the routing information of each message is deserialized, the received buffer is forwarded as-is.
+TEST_F(VAsioConnectionBenchmark, proxy_relay_throughput)
+{
+    constexpr size_t numMessages = 10000;
+    constexpr size_t payloadSize = 1024;
+
+    SilentLogger logger;
+    _connection.SetLogger(&logger);
+
+    ProxiedParticipantPeer source{"Source"};
+    ProxiedParticipantPeer destination{"Destination"};
+    destination.recordSentMessages = false;
+    AddParticipantPeer(&source);
+    AddParticipantPeer(&destination);
+
+    const auto blob = MakeProxyMessageBlob("Source", "Destination", payloadSize);
+    std::vector<SerializedMessage> messages;
+    messages.reserve(numMessages + 1);
+    for (size_t i = 0; i < numMessages + 1; ++i)
+    {
+        messages.emplace_back(std::vector<uint8_t>{blob});
+    }
+
+    // the first message records the association between source and destination
+    _connection.OnSocketData(&source, std::move(messages[0]));
+
+    const auto nsPerMessage = MeasureNanosecondsPerMessage(numMessages, [this, &source, &messages](size_t i) {
+        _connection.OnSocketData(&source, std::move(messages[i + 1]));
+    });
+
+    const auto mibPerSecond = (blob.size() / 1024.0 / 1024.0) / (nsPerMessage / 1e9);
+    std::cout << "proxy relay of " << blob.size() << " byte messages: " << nsPerMessage << " ns/message, "
+              << mibPerSecond << " MiB/s" << std::endl;
+
+    _connection.SetLogger(&_dummyLogger);
+}
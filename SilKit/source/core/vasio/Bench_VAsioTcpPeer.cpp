@@ -0,0 +1,152 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioTcpPeer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "VAsioConnection.hpp"
+#include "MockParticipant.hpp" // for MockLogger
+#include "TimeProvider.hpp"
+#include "LoggingDatatypesInternal.hpp"
+
+namespace {
+
+using namespace SilKit::Core;
+
+class VAsioTcpPeerBenchmark : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _acceptor.open(asio::ip::tcp::v4());
+        _acceptor.bind(asio::ip::tcp::endpoint{asio::ip::address_v4::loopback(), 0});
+        _acceptor.listen();
+    }
+
+    auto MakeConnectedPeer(SilKit::Config::ParticipantConfiguration config) -> std::shared_ptr<VAsioTcpPeer>
+    {
+        _connection =
+            std::make_unique<VAsioConnection>(std::move(config), "VAsioTcpPeerBenchmark", 1, &_timeProvider);
+        _connection->SetLogger(&_logger);
+
+        auto peer = VAsioTcpPeer::Create(_ioContext.get_executor(), _connection.get(), &_logger);
+        peer->Socket().connect(asio::generic::stream_protocol::endpoint{_acceptor.local_endpoint()});
+        _acceptor.accept(_remoteSocket);
+        return peer;
+    }
+
+    auto MakeMessage(const std::string& payload) -> SerializedMessage
+    {
+        SilKit::Services::Logging::LogMsg logMsg;
+        logMsg.logger_name = "VAsioTcpPeerBenchmark";
+        logMsg.payload = payload;
+        return SerializedMessage{logMsg, EndpointAddress{1, 2}, 3};
+    }
+
+    auto ReadRemote(std::size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        asio::read(_remoteSocket, asio::buffer(data));
+        return data;
+    }
+
+protected:
+    asio::io_context _ioContext;
+    asio::ip::tcp::acceptor _acceptor{_ioContext};
+    asio::ip::tcp::socket _remoteSocket{_ioContext};
+    SilKit::Services::Orchestration::TimeProvider _timeProvider;
+    testing::NiceMock<SilKit::Core::Tests::MockLogger> _logger;
+    std::unique_ptr<VAsioConnection> _connection;
+};
+
+} // namespace
+
+// Long-lived threads sending through the same peer, like services publishing from threads of their own. The threads
+// only contend on the lock-free queue, while the IO thread writes concurrently.
+TEST_F(VAsioTcpPeerBenchmark, concurrent_senders_per_message)
+{
+    constexpr size_t numMessagesPerSender = 20000;
+
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.batchedWriteMaxBytes = 64 * 1024;
+    auto peer = MakeConnectedPeer(config);
+    const auto messageSize = MakeMessage("x").ReleaseStorage().size();
+
+    auto workGuard = asio::make_work_guard(_ioContext);
+    std::thread ioThread{[this] {
+        _ioContext.run();
+    }};
+
+    auto measure = [this, &peer, messageSize](size_t numSenders) {
+        std::vector<std::vector<SerializedMessage>> messages(numSenders);
+        for (auto& senderMessages : messages)
+        {
+            for (size_t i = 0; i < numMessagesPerSender; ++i)
+            {
+                senderMessages.emplace_back(MakeMessage("x"));
+            }
+        }
+
+        std::atomic<bool> isStarted{false};
+        std::vector<std::thread> senders;
+        for (auto& senderMessages : messages)
+        {
+            senders.emplace_back([&peer, &isStarted, &senderMessages] {
+                while (!isStarted)
+                {
+                    std::this_thread::yield();
+                }
+                for (auto& message : senderMessages)
+                {
+                    peer->SendSilKitMsg(std::move(message));
+                }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        isStarted = true;
+        ReadRemote(numSenders * numMessagesPerSender * messageSize);
+        const auto duration = std::chrono::steady_clock::now() - start;
+        for (auto& sender : senders)
+        {
+            sender.join();
+        }
+
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+               / (numSenders * numMessagesPerSender);
+    };
+
+    for (size_t numSenders : {1, 4})
+    {
+        std::cout << numSenders << " sending threads: " << measure(numSenders) << " ns/message" << std::endl;
+    }
+
+    workGuard.reset();
+    ioThread.join();
+}
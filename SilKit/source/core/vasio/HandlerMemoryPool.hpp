@@ -0,0 +1,221 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Recycles the memory of handlers posted to an executor.
+//!
+//! The blocks are kept in free lists per size class and reused for the next handler of a similar size, so posting
+//! handlers does not allocate once the pool is warmed up. Blocks larger than the biggest size class are allocated and
+//! released directly. Allocate and Deallocate may be called from any thread.
+class HandlerMemoryPool
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    HandlerMemoryPool() = default;
+    HandlerMemoryPool(const HandlerMemoryPool&) = delete;
+    HandlerMemoryPool& operator=(const HandlerMemoryPool&) = delete;
+
+    ~HandlerMemoryPool()
+    {
+        for (auto& sizeClass : _sizeClasses)
+        {
+            while (sizeClass.freeList != nullptr)
+            {
+                auto* next = sizeClass.freeList->next;
+                ::operator delete(sizeClass.freeList);
+                sizeClass.freeList = next;
+            }
+        }
+    }
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    auto Allocate(size_t size) -> void*
+    {
+        const auto index = SizeClassIndex(size);
+        if (index == NumSizeClasses)
+        {
+            return ::operator new(size);
+        }
+
+        auto& sizeClass = _sizeClasses[index];
+        {
+            std::lock_guard<decltype(sizeClass.mutex)> lock{sizeClass.mutex};
+            if (auto* block = sizeClass.freeList)
+            {
+                sizeClass.freeList = block->next;
+                return block;
+            }
+        }
+        return ::operator new(SizeClassBytes(index));
+    }
+
+    void Deallocate(void* pointer, size_t size)
+    {
+        const auto index = SizeClassIndex(size);
+        if (index == NumSizeClasses)
+        {
+            ::operator delete(pointer);
+            return;
+        }
+
+        auto& sizeClass = _sizeClasses[index];
+        auto* block = new (pointer) FreeBlock{nullptr};
+        std::lock_guard<decltype(sizeClass.mutex)> lock{sizeClass.mutex};
+        block->next = sizeClass.freeList;
+        sizeClass.freeList = block;
+    }
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        FreeBlock* freeList{nullptr};
+    };
+
+    //! Size classes of 64, 128, ..., 1024 bytes
+    static constexpr size_t NumSizeClasses = 5;
+    static constexpr size_t SmallestSizeClassBytes = 64;
+
+    static auto SizeClassBytes(size_t index) -> size_t
+    {
+        return SmallestSizeClassBytes << index;
+    }
+
+    static auto SizeClassIndex(size_t size) -> size_t
+    {
+        size_t index = 0;
+        while (index < NumSizeClasses && SizeClassBytes(index) < size)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::array<SizeClass, NumSizeClasses> _sizeClasses;
+};
+
+//! Standard allocator drawing from a HandlerMemoryPool, used as the associated allocator of posted handlers.
+template <typename T>
+class HandlerAllocator
+{
+public:
+    using value_type = T;
+
+    explicit HandlerAllocator(HandlerMemoryPool& pool)
+        : _pool{&pool}
+    {
+    }
+
+    template <typename U>
+    HandlerAllocator(const HandlerAllocator<U>& other)
+        : _pool{other._pool}
+    {
+    }
+
+    auto allocate(size_t n) -> T*
+    {
+        return static_cast<T*>(_pool->Allocate(sizeof(T) * n));
+    }
+
+    void deallocate(T* pointer, size_t n)
+    {
+        _pool->Deallocate(pointer, sizeof(T) * n);
+    }
+
+    template <typename U>
+    bool operator==(const HandlerAllocator<U>& other) const
+    {
+        return _pool == other._pool;
+    }
+
+    template <typename U>
+    bool operator!=(const HandlerAllocator<U>& other) const
+    {
+        return _pool != other._pool;
+    }
+
+private:
+    template <typename U>
+    friend class HandlerAllocator;
+
+    HandlerMemoryPool* _pool;
+};
+
+//! A handler whose associated allocator draws from a HandlerMemoryPool.
+template <typename HandlerT>
+class PooledHandler
+{
+public:
+    using allocator_type = HandlerAllocator<HandlerT>;
+
+    PooledHandler(HandlerMemoryPool& pool, HandlerT handler)
+        : _pool{&pool}
+        , _handler{std::move(handler)}
+    {
+    }
+
+    auto get_allocator() const noexcept -> allocator_type
+    {
+        return allocator_type{*_pool};
+    }
+
+    template <typename... Args>
+    void operator()(Args&&... args)
+    {
+        _handler(std::forward<Args>(args)...);
+    }
+
+private:
+    HandlerMemoryPool* _pool;
+    HandlerT _handler;
+};
+
+template <typename HandlerT>
+auto MakePooledHandler(HandlerMemoryPool& pool, HandlerT&& handler) -> PooledHandler<std::decay_t<HandlerT>>
+{
+    return PooledHandler<std::decay_t<HandlerT>>{pool, std::forward<HandlerT>(handler)};
+}
+
+} // namespace Core
+} // namespace SilKit
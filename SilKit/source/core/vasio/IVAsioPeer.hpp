@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 
 #include "VAsioPeerInfo.hpp"
@@ -33,6 +34,28 @@ namespace SilKit {
 namespace Core {
 
 class MessageBuffer;
+struct RemoteServiceEndpoint;
+
+//! The messages written by IVAsioPeer::DrainAllBuffers, and those it could not write in time
+struct DrainStatistics
+{
+    uint64_t numDrainedMessages{0};
+    uint64_t numDrainedBytes{0};
+    uint64_t numRemainingMessages{0};
+    uint64_t numRemainingBytes{0};
+};
+
+//! The messages and bytes exchanged with a peer since it was connected, see IVAsioPeer::GetPeerStatistics
+struct PeerStatistics
+{
+    uint64_t numSentMessages{0};
+    uint64_t numSentBytes{0};
+    uint64_t numWrites{0};
+    uint64_t maxQueuedMessages{0};
+    uint64_t maxQueuedBytes{0};
+    uint64_t numReceivedMessages{0};
+    uint64_t numReceivedBytes{0};
+};
 
 class IVAsioPeer
 {
@@ -56,10 +79,16 @@ public:
     //! Start the reading in the IO loop context
     virtual void StartAsyncRead() = 0;
     //! Soft shutdown: Waits until sending queue and incoming messages are processed 
-    virtual void DrainAllBuffers()= 0;
+    virtual auto DrainAllBuffers() -> DrainStatistics = 0;
+    //! Traffic counters, cheap enough to be updated for every message
+    virtual auto GetPeerStatistics() const -> PeerStatistics = 0;
+    //! Write the messages held back while the connection was coalescing the messages of a simulation step
+    virtual void FlushSendBuffers() = 0;
     //! Version management for backward compatibility on network ser/des level
     virtual void SetProtocolVersion(ProtocolVersion v) = 0;
     virtual auto GetProtocolVersion() const -> ProtocolVersion = 0;
+    //! The sender of the messages received from the remote service with the given id, built once per endpoint
+    virtual auto GetRemoteServiceEndpoint(EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint> = 0;
 };
 
 } // namespace Core
@@ -0,0 +1,116 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Unbounded queue for many producer threads and a single consumer thread.
+//!
+//! Push is lock-free: the elements are prepended to an atomic singly linked list. The consumer takes all queued
+//! elements at once and visits them in the order they were pushed.
+template <typename T>
+class MpscQueue
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    MpscQueue() = default;
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue()
+    {
+        Clear();
+    }
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! May be called from any thread
+    void Push(T value)
+    {
+        auto* node = new Node{std::move(value), _head.load(std::memory_order_relaxed)};
+        while (!_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    //! Take all queued elements and invoke the handler with each of them, oldest first.
+    //! Must only be called from the consumer thread.
+    template <typename HandlerT>
+    void PopAll(HandlerT&& handler)
+    {
+        auto* node = _head.exchange(nullptr, std::memory_order_acquire);
+
+        // the list is newest first, reverse it to restore the push order
+        Node* reversed{nullptr};
+        while (node != nullptr)
+        {
+            auto* next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed != nullptr)
+        {
+            auto* next = reversed->next;
+            handler(std::move(reversed->value));
+            delete reversed;
+            reversed = next;
+        }
+    }
+
+    //! Discard all queued elements. Must only be called from the consumer thread.
+    void Clear()
+    {
+        PopAll([](T&&) {});
+    }
+
+    //! May be called from any thread, the result is only a snapshot
+    bool Empty() const
+    {
+        return _head.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+    struct Node
+    {
+        T value;
+        Node* next;
+    };
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::atomic<Node*> _head{nullptr};
+};
+
+} // namespace Core
+} // namespace SilKit
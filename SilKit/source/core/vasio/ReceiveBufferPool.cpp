@@ -0,0 +1,125 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "ReceiveBufferPool.hpp"
+
+namespace SilKit {
+namespace Core {
+
+ReceiveBufferPool::ReceiveBufferPool(std::size_t maxPooledBuffers, std::size_t maxPooledCapacity)
+    : _maxPooledBuffers{maxPooledBuffers}
+    , _maxPooledCapacity{maxPooledCapacity}
+{
+    _buffers.reserve(_maxPooledBuffers);
+    _sharedStorageHolders.reserve(_maxPooledBuffers);
+}
+
+auto ReceiveBufferPool::Acquire(std::size_t size) -> std::vector<uint8_t>
+{
+    if (_buffers.empty())
+    {
+        ReclaimSharedStorage();
+    }
+
+    std::vector<uint8_t> buffer;
+    if (!_buffers.empty())
+    {
+        buffer = std::move(_buffers.back());
+        _buffers.pop_back();
+    }
+
+    if (buffer.capacity() < size)
+    {
+        _numAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    _numAcquired.fetch_add(1, std::memory_order_relaxed);
+
+    buffer.resize(size);
+    return buffer;
+}
+
+void ReceiveBufferPool::Release(std::vector<uint8_t> buffer)
+{
+    if (buffer.capacity() == 0 || buffer.capacity() > _maxPooledCapacity || _buffers.size() >= _maxPooledBuffers)
+    {
+        return;
+    }
+    _buffers.emplace_back(std::move(buffer));
+}
+
+auto ReceiveBufferPool::AcquireSharedStorageHolder() -> std::shared_ptr<std::vector<uint8_t>>
+{
+    for (auto& holder : _sharedStorageHolders)
+    {
+        if (IsUnreferenced(holder))
+        {
+            std::vector<uint8_t> storage;
+            storage.swap(*holder);
+            Release(std::move(storage));
+            return holder;
+        }
+    }
+
+    // all holders are referenced by payloads in flight or retained by user code
+    _numHolderAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto holder = std::make_shared<std::vector<uint8_t>>();
+    if (_sharedStorageHolders.size() < _maxPooledBuffers)
+    {
+        _sharedStorageHolders.push_back(holder);
+    }
+    return holder;
+}
+
+void ReceiveBufferPool::ReclaimSharedStorage()
+{
+    for (auto& holder : _sharedStorageHolders)
+    {
+        if (holder->capacity() != 0 && IsUnreferenced(holder))
+        {
+            std::vector<uint8_t> storage;
+            storage.swap(*holder);
+            Release(std::move(storage));
+        }
+    }
+}
+
+bool ReceiveBufferPool::IsUnreferenced(const std::shared_ptr<std::vector<uint8_t>>& holder)
+{
+    if (holder.use_count() != 1)
+    {
+        return false;
+    }
+    // The last reference may have been dropped on another thread: order its reads of the storage before the reuse
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+}
+
+auto ReceiveBufferPool::GetStatistics() const -> Statistics
+{
+    Statistics statistics;
+    statistics.numAcquired = _numAcquired.load(std::memory_order_relaxed);
+    statistics.numAllocations = _numAllocations.load(std::memory_order_relaxed);
+    statistics.numHolderAllocations = _numHolderAllocations.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+} // namespace Core
+} // namespace SilKit
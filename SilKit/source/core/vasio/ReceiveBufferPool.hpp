@@ -0,0 +1,96 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SilKit {
+namespace Core {
+
+//! \brief Recycles the storage of received messages, so that receiving does not allocate in the steady state.
+//!
+//! The pool itself is not thread-safe and must only be used from the IO thread of its owner.
+//! The statistics may be read from any thread.
+//!
+//! Received storage which is referenced by deserialized payloads is moved into a shared storage holder. The pool
+//! keeps a reference to its holders and reclaims their storage, once the last payload referencing it was dropped,
+//! independently of the thread that dropped it. Payloads retained by user code keep their holder alive, so that the
+//! pool falls back to allocating new holders while all of its holders are in use.
+class ReceiveBufferPool
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+
+    struct Statistics
+    {
+        uint64_t numAcquired{0}; //!< Number of buffers handed out by the pool
+        uint64_t numAllocations{0}; //!< Number of buffers that required a heap allocation
+        uint64_t numHolderAllocations{0}; //!< Number of shared storage holders that required a heap allocation
+    };
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    ReceiveBufferPool(std::size_t maxPooledBuffers = 16, std::size_t maxPooledCapacity = 64 * 1024);
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    //! Return a buffer of the given size, reusing the storage of a previously released buffer if possible.
+    //! The contents of the buffer are unspecified.
+    auto Acquire(std::size_t size) -> std::vector<uint8_t>;
+    //! Return the storage of a buffer to the pool. Buffers exceeding the pooled capacity are freed.
+    void Release(std::vector<uint8_t> buffer);
+    //! Return an empty holder for the storage of a received message, see MessageBuffer::SetSharedStorageHolder.
+    auto AcquireSharedStorageHolder() -> std::shared_ptr<std::vector<uint8_t>>;
+
+    auto GetStatistics() const -> Statistics;
+
+private:
+    // ----------------------------------------
+    // Private Methods
+
+    //! Return the storage of all holders which are not referenced outside of the pool anymore
+    void ReclaimSharedStorage();
+    static bool IsUnreferenced(const std::shared_ptr<std::vector<uint8_t>>& holder);
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::size_t _maxPooledBuffers;
+    std::size_t _maxPooledCapacity;
+    std::vector<std::vector<uint8_t>> _buffers;
+    std::vector<std::shared_ptr<std::vector<uint8_t>>> _sharedStorageHolders;
+
+    std::atomic<uint64_t> _numAcquired{0};
+    std::atomic<uint64_t> _numAllocations{0};
+    std::atomic<uint64_t> _numHolderAllocations{0};
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,138 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "IServiceEndpoint.hpp"
+#include "ServiceDescriptor.hpp"
+#include "silkit/participant/exception.hpp"
+
+namespace SilKit {
+namespace Core {
+
+//! The sender of a message received from a remote participant, as seen by the local links.
+struct RemoteServiceEndpoint : IServiceEndpoint
+{
+    void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
+    {
+        throw LogicError("This method is not supposed to be used in this struct.");
+    }
+
+    auto GetServiceDescriptor() const -> const ServiceDescriptor & override
+    {
+        return _serviceDescriptor; 
+    }
+
+    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
+    {
+        _serviceDescriptor = descriptor;
+    }
+
+private:
+    ServiceDescriptor _serviceDescriptor;
+};
+
+//! Remote service endpoints of a single peer, keyed by their endpoint id.
+//! The endpoint of a remote service is built once, on the first message received from it. Afterwards, receiving a
+//! message only looks up the cached endpoint, which is shared with any distribution still pending on another strand.
+//! Looking up a cached endpoint with a small id does not lock, only building an endpoint does.
+class RemoteServiceEndpointCache
+{
+public:
+    RemoteServiceEndpointCache()
+    {
+        _generations.emplace_back(std::make_unique<Generation>());
+        _current = _generations.back().get();
+    }
+
+    //! Returns the endpoint of the remote service with the given id, using the peer's descriptor as template.
+    auto Get(const ServiceDescriptor& peerDescriptor, EndpointId endpointId)
+        -> std::shared_ptr<const RemoteServiceEndpoint>
+    {
+        if (endpointId < NumDirectSlots)
+        {
+            const auto* endpoint = _current.load(std::memory_order_acquire)->slots[endpointId].load(
+                std::memory_order_acquire);
+            if (endpoint != nullptr)
+            {
+                return *endpoint;
+            }
+        }
+
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        auto* generation = _current.load(std::memory_order_relaxed);
+
+        auto& endpoint = generation->endpoints[endpointId];
+        if (endpoint == nullptr)
+        {
+            ServiceDescriptor descriptor{peerDescriptor};
+            descriptor.SetServiceId(endpointId);
+            endpoint = std::make_shared<const RemoteServiceEndpoint>(descriptor);
+            if (endpointId < NumDirectSlots)
+            {
+                generation->slots[endpointId].store(&endpoint, std::memory_order_release);
+            }
+        }
+        return endpoint;
+    }
+
+    //! Drops all endpoints, e.g., after the peer's descriptor changed.
+    void Clear()
+    {
+        // Readers may still copy an endpoint of the current generation, it is only replaced, not destroyed
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        _generations.emplace_back(std::make_unique<Generation>());
+        _current.store(_generations.back().get(), std::memory_order_release);
+    }
+
+    auto Size() const -> size_t
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+        return _current.load(std::memory_order_relaxed)->endpoints.size();
+    }
+
+private:
+    //! The endpoint ids are handed out consecutively per participant, most of them fit into the slots
+    static constexpr EndpointId NumDirectSlots = 256;
+
+    struct Generation
+    {
+        //! Point into the endpoints, whose nodes are stable and never erased
+        std::array<std::atomic<const std::shared_ptr<const RemoteServiceEndpoint>*>, NumDirectSlots> slots{};
+        std::unordered_map<EndpointId, std::shared_ptr<const RemoteServiceEndpoint>> endpoints;
+    };
+
+private:
+    mutable std::mutex _mutex;
+    std::atomic<Generation*> _current{nullptr};
+    // the replaced generations are kept until the peer is destroyed, a peer's descriptor changes only a few times
+    std::vector<std::unique_ptr<Generation>> _generations;
+};
+
+} // namespace Core
+} // namespace SilKit
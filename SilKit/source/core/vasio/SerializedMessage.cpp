@@ -33,6 +33,15 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
 
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
+    if (HasSharedStorage())
+    {
+        // the shared storage is immutable, copy it and apply the headers of this receiver
+        auto buffer = *_sharedStorage;
+        std::copy(_sharedHeader.begin(), _sharedHeader.end(), buffer.begin());
+        _sharedStorage.reset();
+        return buffer;
+    }
+
     auto buffer = _buffer.ReleaseStorage();
     if (buffer.size() > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
@@ -43,6 +52,82 @@ auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
     return buffer;
 }
 
+auto SerializedMessage::ReleaseSharedStorage() -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError("SerializedMessage::ReleaseSharedStorage called on wrong message kind: "
+                                 + std::to_string((int)_messageKind));
+    }
+    return std::make_shared<const std::vector<uint8_t>>(ReleaseStorage());
+}
+
+SerializedMessage::SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> sharedStorage, EndpointId remoteIndex)
+    : _sharedStorage{std::move(sharedStorage)}
+{
+    const auto& storage = *_sharedStorage;
+    if (storage.size() < SharedHeaderSize + sizeof(EndpointAddress))
+    {
+        throw SilKitError{"SerializedMessage: shared storage is too small to contain the network headers"};
+    }
+
+    std::copy(storage.begin(), storage.begin() + SharedHeaderSize, _sharedHeader.begin());
+
+    // patch the remote index, which is the last element of the shared header
+    _remoteIndex = remoteIndex;
+    memcpy(_sharedHeader.data() + SharedHeaderSize - sizeof(EndpointId), &_remoteIndex, sizeof(EndpointId));
+
+    memcpy(&_messageSize, storage.data(), sizeof(uint32_t));
+    memcpy(&_messageKind, storage.data() + sizeof(uint32_t), sizeof(VAsioMsgKind));
+    memcpy(&_endpointAddress.participant, storage.data() + SharedHeaderSize, sizeof(ParticipantId));
+    memcpy(&_endpointAddress.endpoint, storage.data() + SharedHeaderSize + sizeof(ParticipantId), sizeof(EndpointId));
+}
+
+auto SerializedMessage::HasSharedStorage() const -> bool
+{
+    return _sharedStorage != nullptr;
+}
+
+void SerializedMessage::SetIsControlMsg(bool isControlMsg)
+{
+    _isControlMsg = isControlMsg;
+}
+
+auto SerializedMessage::IsControlMsg() const -> bool
+{
+    return _isControlMsg;
+}
+
+void SerializedMessage::SetIsBroadcastMsg(bool isBroadcastMsg)
+{
+    _isBroadcastMsg = isBroadcastMsg;
+}
+
+auto SerializedMessage::IsBroadcastMsg() const -> bool
+{
+    return _isBroadcastMsg;
+}
+
+void SerializedMessage::SetIsDroppableMsg(bool isDroppableMsg)
+{
+    _isDroppableMsg = isDroppableMsg;
+}
+
+auto SerializedMessage::IsDroppableMsg() const -> bool
+{
+    return _isDroppableMsg;
+}
+
+auto SerializedMessage::GetSharedHeader() const -> const std::array<uint8_t, SharedHeaderSize>&
+{
+    return _sharedHeader;
+}
+
+auto SerializedMessage::GetSharedStorage() const -> const std::shared_ptr<const std::vector<uint8_t>>&
+{
+    return _sharedStorage;
+}
+
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
 {
     return _messageKind;
@@ -88,17 +173,47 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
-void SerializedMessage::WriteNetworkHeaders()
+auto SerializedMessage::PeekProxyMessageRouting() -> ProxyMessageRouting
 {
-    _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
-    _buffer << _messageKind;
+    if (_messageKind != VAsioMsgKind::SilKitProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::PeekProxyMessageRouting called on wrong message kind: "
+                                 + std::to_string((int)_messageKind));
+    }
+    return SilKit::Core::PeekProxyMessageRouting(_buffer);
+}
+
+auto SerializedMessage::ReleaseProxyMessagePayload() -> std::vector<uint8_t>
+{
+    if (_messageKind != VAsioMsgKind::SilKitProxyMessage)
+    {
+        throw SilKitError("SerializedMessage::ReleaseProxyMessagePayload called on wrong message kind: "
+                                 + std::to_string((int)_messageKind));
+    }
+    return ExtractProxyMessagePayload(_buffer);
+}
+
+auto SerializedMessage::ReleaseReceivedStorage() -> std::vector<uint8_t>
+{
+    return _buffer.ReleaseStorage();
+}
+
+void SerializedMessage::SetSharedStorageHolder(std::shared_ptr<std::vector<uint8_t>> holder)
+{
+    _buffer.SetSharedStorageHolder(std::move(holder));
+}
+
+void SerializedMessage::WriteNetworkHeaders(MessageBuffer& buffer) const
+{
+    buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
+    buffer << _messageKind;
     if (_messageKind == VAsioMsgKind::SilKitRegistryMessage)
     {
-        _buffer << _registryKind;
+        buffer << _registryKind;
     }
     if (IsMwOrSim(_messageKind))
     {
-        _buffer << _remoteIndex << _endpointAddress;
+        buffer << _remoteIndex << _endpointAddress;
     }
 }
 
@@ -149,7 +264,14 @@ void SerializedMessage::ReadNetworkHeaders()
     {
         _proxyMessageHeader = PeekProxyMessageHeader(_buffer);
     }
-    if (IsMwOrSim(_messageKind))
+    if (_messageKind == VAsioMsgKind::SilKitSimMsgCompact)
+    {
+        // the participant of the endpoint address is implied by the peer the message was received from
+        _messageKind = VAsioMsgKind::SilKitSimMsg;
+        _endpointAddress = {};
+        ReadCompactSimMsgHeader(_buffer, _remoteIndex, _endpointAddress.endpoint);
+    }
+    else if (IsMwOrSim(_messageKind))
     {
         //optional remoteIndex and endpoint address
         _remoteIndex = ExtractEndpointId(_buffer);
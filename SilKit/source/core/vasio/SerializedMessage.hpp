@@ -19,6 +19,10 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
+
+#include <array>
+#include <memory>
+
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
@@ -26,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 // Component specific Serialize/Deserialize functions
 #include "VAsioSerdes.hpp"
+#include "VAsioSerdes_CompactHeader.hpp"
 #include "CanSerdes.hpp"
 #include "LinSerdes.hpp"
 #include "EthernetSerdes.hpp"
@@ -48,6 +53,18 @@ auto AdlDeserialize(Args&&... args) -> decltype(auto)
 	return Deserialize(std::forward<Args>(args)...);
 }
 
+//! \brief Number of bytes of the serialized message, without the network headers.
+//! Runs the Serialize function of the message against a buffer which only counts the written bytes. For
+//! messages consisting of fixed size members only, this reduces to a constant.
+template <typename MessageT>
+auto SerializedSize(const MessageT& message, ProtocolVersion version = CurrentProtocolVersion()) -> size_t
+{
+    MessageBuffer sizeBuffer{MessageBuffer::ComputeSizeOnly{}};
+    sizeBuffer.SetProtocolVersion(version);
+    Serialize(sizeBuffer, message);
+    return sizeBuffer.WritePos();
+}
+
 // A serialized message used as binary wire format for the VAsio transport.
 class SerializedMessage
 {
@@ -68,6 +85,34 @@ public: // Sending a SerializedMessage: from T to binary blob
 
 	auto ReleaseStorage() -> std::vector<uint8_t>;
 
+public: // Sending a single SerializedMessage to multiple remote receivers
+	//! Size of the network headers that differ between remote receivers: message size, kind and remote index.
+	static constexpr size_t SharedHeaderSize = sizeof(uint32_t) + sizeof(VAsioMsgKind) + sizeof(EndpointId);
+	//! Size of all network headers of a simulation message, which are replaced by the compact headers on the wire.
+	static constexpr size_t SimMsgHeaderSize = SharedHeaderSize + sizeof(ParticipantId) + sizeof(EndpointId);
+
+	//! Finalize the simulation message and move its storage into an immutable buffer, which can be shared by
+	//! multiple SerializedMessages. The message must not be used after the storage was released.
+	auto ReleaseSharedStorage() -> std::shared_ptr<const std::vector<uint8_t>>;
+	//! Reference the shared storage of a simulation message, addressed to a specific remote receiver.
+	//! Only the network headers are stored in this object, the serialized payload is never copied.
+	explicit SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> sharedStorage, EndpointId remoteIndex);
+
+	auto HasSharedStorage() const -> bool;
+	//! Control messages are written ahead of queued data messages, if the peer prioritizes control messages
+	void SetIsControlMsg(bool isControlMsg);
+	auto IsControlMsg() const -> bool;
+	//! Broadcast messages are exchanged between all participants, independently of the services they create
+	void SetIsBroadcastMsg(bool isBroadcastMsg);
+	auto IsBroadcastMsg() const -> bool;
+	//! Droppable messages may be dropped from a full sending queue, if the peer's overflow policy is DropOldest
+	void SetIsDroppableMsg(bool isDroppableMsg);
+	auto IsDroppableMsg() const -> bool;
+	//! The network headers addressed to the remote receiver. They replace the first SharedHeaderSize bytes of the
+	//! shared storage on the wire.
+	auto GetSharedHeader() const -> const std::array<uint8_t, SharedHeaderSize>&;
+	auto GetSharedStorage() const -> const std::shared_ptr<const std::vector<uint8_t>>&;
+
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	explicit SerializedMessage(std::vector<uint8_t>&& blob);
 
@@ -82,10 +127,23 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	auto GetEndpointAddress() const -> EndpointAddress;
 	void SetProtocolVersion(ProtocolVersion version);
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
+	//! Read the source and destination of a proxy message, without deserializing its payload.
+	auto PeekProxyMessageRouting() -> ProxyMessageRouting;
+	//! Move the payload out of a received proxy message, reusing the received storage.
+	//! The message must not be used afterwards.
+	auto ReleaseProxyMessagePayload() -> std::vector<uint8_t>;
 	auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
+	//! Return the storage of the received message, e.g., for reusing it as a receive buffer.
+	//! The returned buffer is empty, if the storage was moved elsewhere.
+	auto ReleaseReceivedStorage() -> std::vector<uint8_t>;
+	//! Recycled holder for the received storage, used once a deserialized payload references the storage.
+	void SetSharedStorageHolder(std::shared_ptr<std::vector<uint8_t>> holder);
 
 private:
-	void WriteNetworkHeaders();
+	//! Writes the network headers and the message into a buffer which is allocated exactly once
+	template <typename MessageT>
+	void WriteMessage(const MessageT& message);
+	void WriteNetworkHeaders(MessageBuffer& buffer) const;
 	void ReadNetworkHeaders();
 	// network headers, some members are optional depending on messageKind
 	uint32_t _messageSize{0};
@@ -100,6 +158,14 @@ private:
     ProxyMessageHeader _proxyMessageHeader;
 
 	MessageBuffer _buffer;
+
+	// For simMsgs sent to multiple remote receivers
+	std::array<uint8_t, SharedHeaderSize> _sharedHeader{};
+	std::shared_ptr<const std::vector<uint8_t>> _sharedStorage;
+
+	bool _isControlMsg{false};
+	bool _isBroadcastMsg{false};
+	bool _isDroppableMsg{false};
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -110,8 +176,7 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 {
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -122,8 +187,7 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _buffer.SetProtocolVersion(version);
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -135,12 +199,24 @@ SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress en
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
-    WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    WriteMessage(message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+// Reserving the exact size before writing avoids the reallocations of the growing buffer. This pays off for fixed
+// size messages as well, where the size pass reduces to a constant.
+template <typename MessageT>
+void SerializedMessage::WriteMessage(const MessageT& message)
+{
+    MessageBuffer headerSizeBuffer{MessageBuffer::ComputeSizeOnly{}};
+    WriteNetworkHeaders(headerSizeBuffer);
+    _buffer.Reserve(headerSizeBuffer.WritePos() + SerializedSize(message, _buffer.GetProtocolVersion()));
+
+    WriteNetworkHeaders(_buffer);
+    Serialize(_buffer, message);
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
@@ -41,7 +41,13 @@ inline constexpr auto messageKind<SubscriptionAcknowledge>() -> VAsioMsgKind { r
 template<>
 inline constexpr auto messageKind<VAsioMsgSubscriber>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncement; }
 template<>
+inline constexpr auto messageKind<SubscriptionAnnouncementBatch>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAnnouncementBatch; }
+template<>
+inline constexpr auto messageKind<SubscriptionAcknowledgeBatch>() -> VAsioMsgKind { return VAsioMsgKind::SubscriptionAcknowledgeBatch; }
+template<>
 inline constexpr auto messageKind<ProxyMessage>() -> VAsioMsgKind { return VAsioMsgKind::SilKitProxyMessage; }
+template<>
+inline constexpr auto messageKind<SharedMemoryMessage>() -> VAsioMsgKind { return VAsioMsgKind::SilKitSharedMemoryMessage; }
 
 template<typename MessageT>
 inline constexpr auto registryMessageKind() -> RegistryMessageKind { return RegistryMessageKind::Invalid; }
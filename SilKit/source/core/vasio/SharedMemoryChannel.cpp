@@ -0,0 +1,373 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SharedMemoryChannel.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "fmt/format.h"
+
+#include "silkit/participant/exception.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#   define SILKIT_HAVE_POSIX_SHARED_MEMORY 1
+#   include <errno.h>
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace SilKit {
+namespace Core {
+
+namespace {
+
+struct SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringCapacity;
+};
+
+constexpr uint32_t SegmentMagic = 0x4d534b53; // "SKSM"
+constexpr uint32_t SegmentVersion = 1;
+constexpr std::size_t SegmentHeaderSize = 64;
+constexpr std::size_t RingHeadersOffset = SegmentHeaderSize;
+constexpr std::size_t RingDataOffset = RingHeadersOffset + 2 * sizeof(SharedMemoryRingHeader);
+//! The segment names are generated by the creator. Only names with this prefix are opened.
+constexpr const char* SegmentNamePrefix = "/SilKit-";
+
+static_assert(sizeof(SegmentHeader) <= SegmentHeaderSize, "SegmentHeader does not fit into the segment");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "SharedMemoryRing requires lock-free atomics to be shared between processes");
+
+auto SegmentSize(std::size_t ringCapacity) -> std::size_t
+{
+    return RingDataOffset + 2 * ringCapacity;
+}
+
+auto RingHeaderAt(void* address, std::size_t index) -> SharedMemoryRingHeader*
+{
+    return reinterpret_cast<SharedMemoryRingHeader*>(static_cast<uint8_t*>(address) + RingHeadersOffset)
+           + index;
+}
+
+auto RingDataAt(void* address, std::size_t ringCapacity, std::size_t index) -> uint8_t*
+{
+    return static_cast<uint8_t*>(address) + RingDataOffset + index * ringCapacity;
+}
+
+} // namespace
+
+// ================================================================================
+//  SharedMemoryRing
+// ================================================================================
+
+SharedMemoryRing::SharedMemoryRing(SharedMemoryRingHeader* header, uint8_t* data, std::size_t capacity)
+    : _header{header}
+    , _data{data}
+    , _capacity{capacity}
+{
+}
+
+auto SharedMemoryRing::Capacity() const -> std::size_t
+{
+    return _capacity;
+}
+
+auto SharedMemoryRing::ReadableBytes() const -> std::size_t
+{
+    const auto readPos = _header->readPos.load(std::memory_order_acquire);
+    const auto writePos = _header->writePos.load();
+    return static_cast<std::size_t>(writePos - readPos);
+}
+
+auto SharedMemoryRing::WritableBytes() const -> std::size_t
+{
+    return _capacity - ReadableBytes();
+}
+
+auto SharedMemoryRing::Write(const void* data, std::size_t size) -> std::size_t
+{
+    const auto writePos = _header->writePos.load(std::memory_order_relaxed);
+    const auto readPos = _header->readPos.load(std::memory_order_acquire);
+    const auto count = std::min(size, _capacity - static_cast<std::size_t>(writePos - readPos));
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto offset = static_cast<std::size_t>(writePos & (_capacity - 1));
+    const auto first = std::min(count, _capacity - offset);
+    memcpy(_data + offset, data, first);
+    memcpy(_data, static_cast<const uint8_t*>(data) + first, count - first);
+
+    // sequentially consistent, so that either WakeReader observes a suspended reader, or SuspendReader observes
+    // the written data
+    _header->writePos.store(writePos + count);
+    return count;
+}
+
+bool SharedMemoryRing::WakeReader()
+{
+    return _header->readerSuspended.exchange(0) != 0;
+}
+
+bool SharedMemoryRing::SuspendWriter()
+{
+    _header->writerSuspended.store(1);
+    if (WritableBytes() == 0)
+    {
+        return true;
+    }
+    // The reader made room in the meantime. If it already consumed the flag, its notification is spurious.
+    _header->writerSuspended.exchange(0);
+    return false;
+}
+
+auto SharedMemoryRing::Read(void* data, std::size_t size) -> std::size_t
+{
+    const auto readPos = _header->readPos.load(std::memory_order_relaxed);
+    const auto writePos = _header->writePos.load(std::memory_order_acquire);
+    const auto count = std::min(size, static_cast<std::size_t>(writePos - readPos));
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    const auto offset = static_cast<std::size_t>(readPos & (_capacity - 1));
+    const auto first = std::min(count, _capacity - offset);
+    memcpy(data, _data + offset, first);
+    memcpy(static_cast<uint8_t*>(data) + first, _data, count - first);
+
+    _header->readPos.store(readPos + count);
+    return count;
+}
+
+bool SharedMemoryRing::WakeWriter()
+{
+    return _header->writerSuspended.exchange(0) != 0;
+}
+
+bool SharedMemoryRing::SuspendReader()
+{
+    _header->readerSuspended.store(1);
+    if (ReadableBytes() == 0)
+    {
+        return true;
+    }
+    // The writer added data in the meantime. If it already consumed the flag, its notification is spurious.
+    _header->readerSuspended.exchange(0);
+    return false;
+}
+
+// ================================================================================
+//  SharedMemoryChannel
+// ================================================================================
+
+SharedMemoryChannel::SharedMemoryChannel(std::string name, void* address, std::size_t size, bool isCreator)
+    : _name{std::move(name)}
+    , _address{address}
+    , _size{size}
+    , _isLinked{isCreator}
+{
+    const auto* segmentHeader = static_cast<const SegmentHeader*>(_address);
+    const auto ringCapacity = static_cast<std::size_t>(segmentHeader->ringCapacity);
+
+    const std::size_t sendIndex = isCreator ? 0 : 1;
+    const std::size_t receiveIndex = isCreator ? 1 : 0;
+    _sendRing = std::make_unique<SharedMemoryRing>(RingHeaderAt(_address, sendIndex),
+                                                   RingDataAt(_address, ringCapacity, sendIndex), ringCapacity);
+    _receiveRing = std::make_unique<SharedMemoryRing>(RingHeaderAt(_address, receiveIndex),
+                                                      RingDataAt(_address, ringCapacity, receiveIndex), ringCapacity);
+}
+
+auto SharedMemoryChannel::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+auto SharedMemoryChannel::SendRing() -> SharedMemoryRing&
+{
+    return *_sendRing;
+}
+
+auto SharedMemoryChannel::ReceiveRing() -> SharedMemoryRing&
+{
+    return *_receiveRing;
+}
+
+#if defined(SILKIT_HAVE_POSIX_SHARED_MEMORY)
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+    Unlink();
+    munmap(_address, _size);
+}
+
+bool SharedMemoryChannel::IsSupported()
+{
+    return true;
+}
+
+void SharedMemoryChannel::Unlink()
+{
+    if (_isLinked)
+    {
+        shm_unlink(_name.c_str());
+        _isLinked = false;
+    }
+}
+
+auto SharedMemoryChannel::Create(std::size_t ringCapacity) -> std::unique_ptr<SharedMemoryChannel>
+{
+    static std::atomic<uint32_t> segmentCounter{0};
+
+    if (ringCapacity == 0 || (ringCapacity & (ringCapacity - 1)) != 0)
+    {
+        throw SilKitError{"SharedMemoryChannel: the ring capacity must be a power of two"};
+    }
+
+    const auto size = SegmentSize(ringCapacity);
+
+    // a stale segment of a crashed process with the same pid might still exist, try the next name in that case
+    std::string name;
+    int fd = -1;
+    for (int attempt = 0; attempt < 16 && fd < 0; ++attempt)
+    {
+        name = fmt::format("{}{}-{}", SegmentNamePrefix, getpid(), segmentCounter++);
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0 && errno != EEXIST)
+        {
+            break;
+        }
+    }
+    if (fd < 0)
+    {
+        throw SilKitError{fmt::format("SharedMemoryChannel: cannot create segment '{}': {}", name, strerror(errno))};
+    }
+
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        const auto error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throw SilKitError{fmt::format("SharedMemoryChannel: cannot resize segment '{}': {}", name, strerror(error))};
+    }
+
+    auto* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto error = errno;
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        throw SilKitError{fmt::format("SharedMemoryChannel: cannot map segment '{}': {}", name, strerror(error))};
+    }
+
+    // the memory of a new segment is zero initialized
+    auto* segmentHeader = new (address) SegmentHeader{};
+    segmentHeader->magic = SegmentMagic;
+    segmentHeader->version = SegmentVersion;
+    segmentHeader->ringCapacity = ringCapacity;
+    for (std::size_t index = 0; index < 2; ++index)
+    {
+        auto* ringHeader = new (RingHeaderAt(address, index)) SharedMemoryRingHeader;
+        ringHeader->writePos.store(0);
+        ringHeader->readPos.store(0);
+        // the reader is only woken up once data is written
+        ringHeader->readerSuspended.store(1);
+        ringHeader->writerSuspended.store(0);
+    }
+
+    return std::unique_ptr<SharedMemoryChannel>{new SharedMemoryChannel{name, address, size, true}};
+}
+
+auto SharedMemoryChannel::Open(const std::string& name) -> std::unique_ptr<SharedMemoryChannel>
+{
+    if (name.compare(0, strlen(SegmentNamePrefix), SegmentNamePrefix) != 0)
+    {
+        throw SilKitError{fmt::format("SharedMemoryChannel: invalid segment name '{}'", name)};
+    }
+
+    const int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+    {
+        throw SilKitError{fmt::format("SharedMemoryChannel: cannot open segment '{}': {}", name, strerror(errno))};
+    }
+
+    struct stat status{};
+    if (fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < RingDataOffset)
+    {
+        close(fd);
+        throw SilKitError{fmt::format("SharedMemoryChannel: segment '{}' is too small", name)};
+    }
+
+    const auto size = static_cast<std::size_t>(status.st_size);
+    auto* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const auto error = errno;
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        throw SilKitError{fmt::format("SharedMemoryChannel: cannot map segment '{}': {}", name, strerror(error))};
+    }
+
+    const auto* segmentHeader = static_cast<const SegmentHeader*>(address);
+    const auto ringCapacity = static_cast<std::size_t>(segmentHeader->ringCapacity);
+    if (segmentHeader->magic != SegmentMagic || segmentHeader->version != SegmentVersion || ringCapacity == 0
+        || (ringCapacity & (ringCapacity - 1)) != 0 || SegmentSize(ringCapacity) != size)
+    {
+        munmap(address, size);
+        throw SilKitError{fmt::format("SharedMemoryChannel: segment '{}' has an unsupported layout", name)};
+    }
+
+    return std::unique_ptr<SharedMemoryChannel>{new SharedMemoryChannel{name, address, size, false}};
+}
+
+#else
+
+SharedMemoryChannel::~SharedMemoryChannel() = default;
+
+bool SharedMemoryChannel::IsSupported()
+{
+    return false;
+}
+
+void SharedMemoryChannel::Unlink()
+{
+}
+
+auto SharedMemoryChannel::Create(std::size_t) -> std::unique_ptr<SharedMemoryChannel>
+{
+    throw SilKitError{"SharedMemoryChannel: shared memory is not supported on this platform"};
+}
+
+auto SharedMemoryChannel::Open(const std::string&) -> std::unique_ptr<SharedMemoryChannel>
+{
+    throw SilKitError{"SharedMemoryChannel: shared memory is not supported on this platform"};
+}
+
+#endif
+
+} // namespace Core
+} // namespace SilKit
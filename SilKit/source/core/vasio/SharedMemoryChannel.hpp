@@ -0,0 +1,141 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace SilKit {
+namespace Core {
+
+//! Control block of a SharedMemoryRing, which is placed in the shared memory segment.
+struct SharedMemoryRingHeader
+{
+    // Owned by the writer
+    alignas(64) std::atomic<uint64_t> writePos;
+    std::atomic<uint32_t> readerSuspended;
+    // Owned by the reader
+    alignas(64) std::atomic<uint64_t> readPos;
+    std::atomic<uint32_t> writerSuspended;
+};
+
+//! \brief Lock-free single-producer single-consumer byte ring in shared memory.
+//!
+//! The ring transports a byte stream, the framing of messages is left to the user.
+//! Writer and reader never block: If the reader finds the ring empty, it suspends itself and the writer is told
+//! by WakeReader to notify it once new data was written. The same holds for a writer finding the ring full.
+class SharedMemoryRing
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    SharedMemoryRing(SharedMemoryRingHeader* header, uint8_t* data, std::size_t capacity);
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    auto Capacity() const -> std::size_t;
+    auto ReadableBytes() const -> std::size_t;
+    auto WritableBytes() const -> std::size_t;
+
+    //! Copy up to size bytes into the ring. Returns the number of bytes written.
+    auto Write(const void* data, std::size_t size) -> std::size_t;
+    //! Returns true, if the reader was suspended and must be notified about the written data.
+    bool WakeReader();
+    //! Suspend the writer, unless the ring is not full anymore. Returns true, if the writer was suspended.
+    bool SuspendWriter();
+
+    //! Copy up to size bytes out of the ring. Returns the number of bytes read.
+    auto Read(void* data, std::size_t size) -> std::size_t;
+    //! Returns true, if the writer was suspended and must be notified about the available space.
+    bool WakeWriter();
+    //! Suspend the reader, unless the ring is not empty anymore. Returns true, if the reader was suspended.
+    bool SuspendReader();
+
+private:
+    // ----------------------------------------
+    // Private Members
+    SharedMemoryRingHeader* _header;
+    uint8_t* _data;
+    std::size_t _capacity;
+};
+
+//! \brief A named shared memory segment containing one SharedMemoryRing per direction.
+//!
+//! The segment is created by one peer and opened by the other peer by its name. The creator sends on the first
+//! ring and receives on the second ring, and vice versa.
+class SharedMemoryChannel
+{
+public:
+    // ----------------------------------------
+    // Public Data Types
+    static constexpr std::size_t DefaultRingCapacity = 1024 * 1024;
+
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+    ~SharedMemoryChannel();
+
+private:
+    // ----------------------------------------
+    // Private Constructors
+    SharedMemoryChannel(std::string name, void* address, std::size_t size, bool isCreator);
+
+public:
+    // ----------------------------------------
+    // Public Construction Functions
+
+    //! Returns true, if shared memory segments are supported on this platform.
+    static bool IsSupported();
+    //! Create a new segment with a unique name. The ring capacity must be a power of two.
+    static auto Create(std::size_t ringCapacity = DefaultRingCapacity) -> std::unique_ptr<SharedMemoryChannel>;
+    //! Open a segment created by the remote peer. Throws a SilKitError, if the segment cannot be used.
+    static auto Open(const std::string& name) -> std::unique_ptr<SharedMemoryChannel>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    auto GetName() const -> const std::string&;
+    //! Remove the name of the segment, e.g., once the remote peer opened it. The segment stays mapped.
+    void Unlink();
+
+    auto SendRing() -> SharedMemoryRing&;
+    auto ReceiveRing() -> SharedMemoryRing&;
+
+private:
+    // ----------------------------------------
+    // Private Members
+    std::string _name;
+    void* _address;
+    std::size_t _size;
+    bool _isLinked;
+    std::unique_ptr<SharedMemoryRing> _sendRing;
+    std::unique_ptr<SharedMemoryRing> _receiveRing;
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
+
 #include "ILogger.hpp"
 
 #include "VAsioTransmitter.hpp"
@@ -32,6 +34,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Core {
 
+//! The messages distributed by a link, see SilKitLink::GetStatistics
+struct LinkStatistics
+{
+    uint64_t numSentMessages{0}; //!< Number of messages sent by local services
+    uint64_t numReceivedMessages{0}; //!< Number of messages received from remote participants
+};
+
 template <class MsgT>
 class SilKitLink
 {
@@ -63,11 +72,35 @@ public:
 
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg);
 
+    auto GetStatistics() const -> LinkStatistics;
+
 private:
     // ----------------------------------------
     // private methods
     void DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoint* from, const MsgT& msg);
 
+private:
+    // ----------------------------------------
+    // private data types
+
+    //! A local receiver with the identity of its service, taken once when it is added to the link.
+    //! All local receivers of a link share the link's network name, so it is not part of the identity.
+    struct LocalReceiver
+    {
+        ReceiverT* receiver;
+        const IServiceEndpoint* endpoint;
+        ParticipantId participantId;
+        ServiceType serviceType;
+        EndpointId serviceId;
+
+        bool IsSameServiceAs(const IServiceEndpoint* from, const ServiceDescriptor& fromDescriptor) const
+        {
+            return endpoint == from
+                   || (serviceId == fromDescriptor.GetServiceId() && serviceType == fromDescriptor.GetServiceType()
+                       && participantId == fromDescriptor.GetParticipantId());
+        }
+    };
+
 private:
     // ----------------------------------------
     // private members
@@ -75,8 +108,11 @@ private:
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
 
-    std::vector<ReceiverT*> _localReceivers;
+    std::vector<LocalReceiver> _localReceivers;
     VAsioTransmitter<MsgT> _vasioTransmitter;
+
+    std::atomic<uint64_t> _numSentMessages{0};
+    std::atomic<uint64_t> _numReceivedMessages{0};
 };
 
 // ================================================================================
@@ -93,8 +129,15 @@ SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logge
 template <class MsgT>
 void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 {
-    if (std::find(_localReceivers.begin(), _localReceivers.end(), receiver) != _localReceivers.end()) return;
-    _localReceivers.push_back(receiver);
+    auto it = std::find_if(_localReceivers.begin(), _localReceivers.end(), [receiver](const LocalReceiver& localReceiver) {
+        return localReceiver.receiver == receiver;
+    });
+    if (it != _localReceivers.end()) return;
+
+    const auto* endpoint = dynamic_cast<const IServiceEndpoint*>(receiver);
+    const auto& descriptor = endpoint->GetServiceDescriptor();
+    _localReceivers.push_back(LocalReceiver{receiver, endpoint, descriptor.GetParticipantId(),
+                                            descriptor.GetServiceType(), descriptor.GetServiceId()});
 }
 
 template <class MsgT>
@@ -141,14 +184,16 @@ void SetTimestamp(MsgT& /*msg*/, std::chrono::nanoseconds /*value*/, std::enable
 template <class MsgT>
 void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* from, MsgT&& msg)
 {
+    _numReceivedMessages.fetch_add(1, std::memory_order_relaxed);
+
     if (_timeProvider->IsSynchronizingVirtualTime())
     {
         SetTimestamp(msg, _timeProvider->Now());
     }
 
-    for (auto&& receiver : _localReceivers)
+    for (auto&& localReceiver : _localReceivers)
     {
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -159,16 +204,17 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
     // NB: Messages must be dispatched to remote receivers first.
     // Otherwise, messages that may be produced during the internal dispatch will be dispatched to remote receivers first.
     // As a result, the messages may be delivered in the wrong order (possibly even reversed)
+    _numSentMessages.fetch_add(1, std::memory_order_relaxed);
     DispatchSilKitMessage(&_vasioTransmitter, from, msg);
-    for (auto&& receiver : _localReceivers)
+    const auto& fromDescriptor = from->GetServiceDescriptor();
+    for (auto&& localReceiver : _localReceivers)
     {
-        auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
         // C++ 17 -> if constexpr
         if (!SilKitMsgTraits<MsgT>::IsSelfDeliveryEnforced())
         {
-            if (receiverId->GetServiceDescriptor() == from->GetServiceDescriptor()) continue;
+            if (localReceiver.IsSameServiceAs(from, fromDescriptor)) continue;
         }
-        DispatchSilKitMessage(receiver, from, msg);
+        DispatchSilKitMessage(localReceiver.receiver, from, msg);
     }
 }
 
@@ -193,9 +239,19 @@ void SilKitLink<MsgT>::DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoi
 template <class MsgT>
 void SilKitLink<MsgT>::DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
 {
+    _numSentMessages.fetch_add(1, std::memory_order_relaxed);
     _vasioTransmitter.SendMessageToTarget(from, targetParticipantName, msg);
 }
 
+template <class MsgT>
+auto SilKitLink<MsgT>::GetStatistics() const -> LinkStatistics
+{
+    LinkStatistics linkStatistics;
+    linkStatistics.numSentMessages = _numSentMessages.load(std::memory_order_relaxed);
+    linkStatistics.numReceivedMessages = _numReceivedMessages.load(std::memory_order_relaxed);
+    return linkStatistics;
+}
+
 template <class MsgT>
 void SilKitLink<MsgT>::SetHistoryLength(size_t history)
 {
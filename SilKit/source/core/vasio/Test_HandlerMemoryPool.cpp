@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "HandlerMemoryPool.hpp"
+
+#include "asio.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(HandlerMemoryPoolTest, blocks_are_reused_within_their_size_class)
+{
+    HandlerMemoryPool pool;
+
+    auto* first = pool.Allocate(100);
+    pool.Deallocate(first, 100);
+
+    // 100 and 120 bytes share the size class of 128 bytes
+    auto* second = pool.Allocate(120);
+    EXPECT_EQ(second, first);
+
+    // the free list of the size class is empty again
+    auto* third = pool.Allocate(100);
+    EXPECT_NE(third, second);
+
+    pool.Deallocate(second, 120);
+    pool.Deallocate(third, 100);
+}
+
+TEST(HandlerMemoryPoolTest, blocks_larger_than_the_size_classes_are_not_kept)
+{
+    HandlerMemoryPool pool;
+
+    auto* large = pool.Allocate(4096);
+    ASSERT_NE(large, nullptr);
+    pool.Deallocate(large, 4096);
+}
+
+TEST(HandlerMemoryPoolTest, posted_pooled_handlers_are_invoked)
+{
+    HandlerMemoryPool pool;
+    asio::io_context ioContext;
+
+    int invocations{0};
+    for (auto i = 0; i < 3; ++i)
+    {
+        asio::post(ioContext, MakePooledHandler(pool, [&invocations] { ++invocations; }));
+    }
+    ioContext.run();
+
+    EXPECT_EQ(invocations, 3);
+}
+
+} // anonymous namespace
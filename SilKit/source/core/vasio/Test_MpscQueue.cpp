@@ -0,0 +1,105 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "MpscQueue.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(MpscQueueTest, pop_all_preserves_push_order)
+{
+    MpscQueue<int> queue;
+    EXPECT_TRUE(queue.Empty());
+
+    for (auto i = 0; i < 5; ++i)
+    {
+        queue.Push(i);
+    }
+    EXPECT_FALSE(queue.Empty());
+
+    std::vector<int> popped;
+    queue.PopAll([&popped](int value) { popped.push_back(value); });
+
+    EXPECT_EQ(popped, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(queue.Empty());
+}
+
+TEST(MpscQueueTest, clear_and_destructor_free_the_elements)
+{
+    auto value = std::make_shared<int>(42);
+    {
+        MpscQueue<std::shared_ptr<int>> queue;
+        queue.Push(value);
+        queue.Clear();
+        EXPECT_EQ(value.use_count(), 1);
+
+        queue.Push(value);
+        queue.Push(value);
+        EXPECT_EQ(value.use_count(), 3);
+    }
+    EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(MpscQueueTest, concurrent_producers)
+{
+    constexpr int numProducers = 4;
+    constexpr int numValuesPerProducer = 10000;
+
+    MpscQueue<std::pair<int, int>> queue;
+
+    std::vector<std::thread> producers;
+    for (auto producer = 0; producer < numProducers; ++producer)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (auto i = 0; i < numValuesPerProducer; ++i)
+            {
+                queue.Push(std::make_pair(producer, i));
+            }
+        });
+    }
+
+    // consume while the producers are running, the values of each producer must arrive in order
+    std::vector<int> nextValue(numProducers, 0);
+    auto numPopped = 0;
+    while (numPopped < numProducers * numValuesPerProducer)
+    {
+        queue.PopAll([&](std::pair<int, int> value) {
+            EXPECT_EQ(value.second, nextValue[value.first]);
+            nextValue[value.first] = value.second + 1;
+            ++numPopped;
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.Empty());
+}
+
+} // anonymous namespace
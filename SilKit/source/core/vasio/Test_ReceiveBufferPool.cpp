@@ -0,0 +1,121 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "ReceiveBufferPool.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+TEST(ReceiveBufferPoolTest, released_buffers_are_reused)
+{
+    ReceiveBufferPool pool;
+
+    auto buffer = pool.Acquire(100);
+    ASSERT_EQ(buffer.size(), 100u);
+    const auto* data = buffer.data();
+    pool.Release(std::move(buffer));
+
+    buffer = pool.Acquire(50);
+    ASSERT_EQ(buffer.size(), 50u);
+    EXPECT_EQ(buffer.data(), data);
+
+    EXPECT_EQ(pool.GetStatistics().numAcquired, 2u);
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 1u);
+}
+
+TEST(ReceiveBufferPoolTest, growing_a_reused_buffer_is_an_allocation)
+{
+    ReceiveBufferPool pool;
+
+    pool.Release(pool.Acquire(10));
+    auto buffer = pool.Acquire(1000);
+    ASSERT_EQ(buffer.size(), 1000u);
+
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 2u);
+}
+
+TEST(ReceiveBufferPoolTest, limits_are_respected)
+{
+    ReceiveBufferPool pool{1, 1000};
+
+    // too large buffers are not pooled
+    pool.Release(pool.Acquire(2000));
+    pool.Acquire(10);
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 2u);
+
+    // only a single buffer is pooled
+    auto first = pool.Acquire(10);
+    auto second = pool.Acquire(10);
+    pool.Release(std::move(first));
+    pool.Release(std::move(second));
+    pool.Acquire(10);
+    pool.Acquire(10);
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 5u);
+}
+
+TEST(ReceiveBufferPoolTest, shared_storage_is_reclaimed_once_unreferenced)
+{
+    ReceiveBufferPool pool;
+
+    auto holder = pool.AcquireSharedStorageHolder();
+    *holder = pool.Acquire(100);
+    const auto* data = holder->data();
+
+    // a payload referencing the storage is dropped, e.g., after it was delivered to the user
+    auto payload = std::shared_ptr<const uint8_t>{holder, holder->data()};
+    holder.reset();
+    payload.reset();
+
+    auto buffer = pool.Acquire(50);
+    EXPECT_EQ(buffer.data(), data);
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 1u);
+
+    // the holder itself is reused as well
+    pool.AcquireSharedStorageHolder();
+    EXPECT_EQ(pool.GetStatistics().numHolderAllocations, 1u);
+}
+
+TEST(ReceiveBufferPoolTest, retained_shared_storage_is_not_reused)
+{
+    ReceiveBufferPool pool;
+
+    auto holder = pool.AcquireSharedStorageHolder();
+    *holder = pool.Acquire(100);
+    const auto* data = holder->data();
+
+    // the payload is retained, e.g., by user code
+    auto payload = std::shared_ptr<const uint8_t>{holder, holder->data()};
+    holder.reset();
+
+    auto buffer = pool.Acquire(100);
+    EXPECT_NE(buffer.data(), data);
+    EXPECT_EQ(pool.GetStatistics().numAllocations, 2u);
+
+    auto otherHolder = pool.AcquireSharedStorageHolder();
+    EXPECT_TRUE(otherHolder->empty());
+    EXPECT_EQ(pool.GetStatistics().numHolderAllocations, 2u);
+    EXPECT_EQ(payload.get(), data);
+}
+
+} // anonymous namespace
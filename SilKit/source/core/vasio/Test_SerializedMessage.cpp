@@ -22,8 +22,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SerializedMessage.hpp"
 
 #include <cstdint>
+#include <cstring>
 #include <array>
+#include <chrono>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -55,6 +59,48 @@ struct PackedHandshake
 
 using namespace SilKit::Core;
 
+namespace {
+
+auto MakeLogMsg(size_t payloadSize) -> SilKit::Services::Logging::LogMsg
+{
+    SilKit::Services::Logging::LogMsg logMsg;
+    logMsg.logger_name = "SerializedSizeTest";
+    logMsg.payload.assign(payloadSize, 'x');
+    return logMsg;
+}
+
+auto MakeDataMessageEvent(size_t payloadSize) -> SilKit::Services::PubSub::WireDataMessageEvent
+{
+    SilKit::Services::PubSub::WireDataMessageEvent dataMessageEvent{};
+    dataMessageEvent.timestamp = std::chrono::nanoseconds{1};
+    dataMessageEvent.data = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 'x')};
+    return dataMessageEvent;
+}
+
+auto MakeCanFrameEvent(size_t payloadSize) -> SilKit::Services::Can::WireCanFrameEvent
+{
+    SilKit::Services::Can::WireCanFrameEvent canFrameEvent{};
+    canFrameEvent.frame.canId = 3;
+    canFrameEvent.frame.dataField = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(payloadSize, 'x')};
+    return canFrameEvent;
+}
+
+template <typename MessageT>
+void ExpectSerializedExactlyOnce(const MessageT& message)
+{
+    SerializedMessage serializedMessage{message, EndpointAddress{1234, 5}, 7};
+    const auto blob = serializedMessage.ReleaseStorage();
+
+    // the message size, message kind, remote index and endpoint address
+    const auto headerSize = SerializedMessage::SharedHeaderSize + sizeof(EndpointAddress::participant)
+                            + sizeof(EndpointAddress::endpoint);
+    EXPECT_EQ(blob.size(), headerSize + SerializedSize(message));
+    // the storage was allocated once with the exact size, and never grown
+    EXPECT_EQ(blob.capacity(), blob.size());
+}
+
+} // namespace
+
 TEST(VAsioSerializedMessage, packed_handshake_message)
 {
     //test if network layout of connection handshake changed
@@ -95,3 +141,149 @@ TEST(VAsioSerializedMessage, packed_handshake_message)
 
     ASSERT_EQ(to_string(ptr->acceptorUri0, ptr->acceptorUri0Size), announcement.peerInfo.acceptorUris.at(0));
 }
+
+TEST(VAsioSerializedMessage, shared_storage_patches_remote_index)
+{
+    SilKit::Services::Logging::LogMsg logMsg;
+    logMsg.logger_name = "SharedStorageTest";
+    logMsg.payload = "shared payload";
+    const EndpointAddress endpointAddress{1234, 5};
+
+    auto sharedStorage = SerializedMessage{logMsg, endpointAddress, 0}.ReleaseSharedStorage();
+
+    for (const EndpointId remoteIndex : {EndpointId{7}, EndpointId{42}})
+    {
+        SerializedMessage sharedMsg{sharedStorage, remoteIndex};
+        ASSERT_TRUE(sharedMsg.HasSharedStorage());
+        ASSERT_EQ(sharedMsg.GetSharedStorage(), sharedStorage);
+
+        // a copy of the storage with the patched headers is identical to a message serialized for the receiver
+        auto expectedBlob = SerializedMessage{logMsg, endpointAddress, remoteIndex}.ReleaseStorage();
+        auto blob = sharedMsg.ReleaseStorage();
+        ASSERT_EQ(blob, expectedBlob);
+
+        SerializedMessage receivedMsg{std::move(blob)};
+        ASSERT_EQ(receivedMsg.GetMessageKind(), VAsioMsgKind::SilKitMwMsg);
+        ASSERT_EQ(receivedMsg.GetRemoteIndex(), remoteIndex);
+        ASSERT_EQ(receivedMsg.GetEndpointAddress(), endpointAddress);
+
+        auto receivedLogMsg = receivedMsg.Deserialize<SilKit::Services::Logging::LogMsg>();
+        ASSERT_EQ(receivedLogMsg.logger_name, logMsg.logger_name);
+        ASSERT_EQ(receivedLogMsg.payload, logMsg.payload);
+    }
+
+    // the shared storage itself is left untouched
+    ASSERT_EQ(SerializedMessage{std::vector<uint8_t>{*sharedStorage}}.GetRemoteIndex(), EndpointId{0});
+}
+
+TEST(VAsioSerializedMessage, proxy_message_routing_and_payload_without_deserialization)
+{
+    SilKit::Services::Logging::LogMsg logMsg;
+    logMsg.logger_name = "ProxiedLogger";
+    logMsg.payload = "proxied payload";
+    const EndpointAddress endpointAddress{1234, 5};
+
+    ProxyMessage proxyMessage{};
+    proxyMessage.source = "Source";
+    proxyMessage.destination = "Destination";
+    proxyMessage.payload = SerializedMessage{logMsg, endpointAddress, 7}.ReleaseStorage();
+
+    const auto blob = SerializedMessage{proxyMessage}.ReleaseStorage();
+
+    SerializedMessage receivedMsg{std::vector<uint8_t>{blob}};
+    ASSERT_EQ(receivedMsg.GetMessageKind(), VAsioMsgKind::SilKitProxyMessage);
+
+    const auto routing = receivedMsg.PeekProxyMessageRouting();
+    ASSERT_EQ(routing.header.version, 0);
+    ASSERT_EQ(routing.source, proxyMessage.source);
+    ASSERT_EQ(routing.destination, proxyMessage.destination);
+
+    // peeking leaves the message untouched, a relayed message is identical to the received one
+    ASSERT_EQ(SerializedMessage{receivedMsg}.ReleaseStorage(), blob);
+
+    const auto payload = receivedMsg.ReleaseProxyMessagePayload();
+    ASSERT_EQ(payload, proxyMessage.payload);
+
+    SerializedMessage innerMsg{std::vector<uint8_t>{payload}};
+    ASSERT_EQ(innerMsg.GetRemoteIndex(), EndpointId{7});
+    ASSERT_EQ(innerMsg.GetEndpointAddress(), endpointAddress);
+    ASSERT_EQ(innerMsg.Deserialize<SilKit::Services::Logging::LogMsg>().payload, logMsg.payload);
+
+    // an empty payload notifies the destination about the shutdown of the source
+    proxyMessage.payload.clear();
+    SerializedMessage shutdownMsg{SerializedMessage{proxyMessage}.ReleaseStorage()};
+    ASSERT_TRUE(shutdownMsg.ReleaseProxyMessagePayload().empty());
+}
+
+TEST(VAsioSerializedMessage, serialized_size_allocates_the_storage_once)
+{
+    for (const size_t payloadSize : {size_t{0}, size_t{8}, size_t{100}, size_t{65536}})
+    {
+        ExpectSerializedExactlyOnce(MakeLogMsg(payloadSize));
+        ExpectSerializedExactlyOnce(MakeDataMessageEvent(payloadSize));
+        ExpectSerializedExactlyOnce(MakeCanFrameEvent(payloadSize));
+    }
+
+    // registry messages have no endpoint address
+    ParticipantAnnouncement announcement;
+    announcement.peerInfo.participantName = "SerdesTest";
+    announcement.peerInfo.acceptorUris = {"https://example.com:1234"};
+    const auto blob = SerializedMessage{announcement}.ReleaseStorage();
+    EXPECT_EQ(blob.size(), sizeof(PackedHandshake));
+    EXPECT_EQ(blob.capacity(), blob.size());
+}
+
+TEST(VAsioSerializedMessage, varints_round_trip)
+{
+    for (const uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{127}, uint64_t{128}, uint64_t{300},
+                                 uint64_t{1} << 35, std::numeric_limits<uint64_t>::max()})
+    {
+        std::vector<uint8_t> data(MaxVarintSize);
+        data.resize(WriteVarint(value, data.data()));
+
+        MessageBuffer buffer{std::move(data)};
+        EXPECT_EQ(ReadVarint(buffer), value);
+        EXPECT_EQ(buffer.RemainingBytesLeft(), 0u);
+    }
+
+    EXPECT_EQ(WriteVarint(127, std::vector<uint8_t>(MaxVarintSize).data()), 1u);
+    EXPECT_EQ(WriteVarint(128, std::vector<uint8_t>(MaxVarintSize).data()), 2u);
+    EXPECT_EQ(WriteVarint(std::numeric_limits<uint64_t>::max(), std::vector<uint8_t>(MaxVarintSize).data()),
+              MaxVarintSize);
+
+    // truncated and overlong encodings
+    MessageBuffer truncated{std::vector<uint8_t>{0x80}};
+    EXPECT_THROW(ReadVarint(truncated), end_of_buffer);
+    MessageBuffer overlong{std::vector<uint8_t>(MaxVarintSize + 1, 0x80)};
+    EXPECT_THROW(ReadVarint(overlong), end_of_buffer);
+}
+
+TEST(VAsioSerializedMessage, compact_header_is_read_as_simulation_message)
+{
+    SilKit::Services::Logging::LogMsg logMsg;
+    logMsg.logger_name = "CompactLogger";
+    logMsg.payload = "compact payload";
+
+    const auto fullBlob = SerializedMessage{logMsg, EndpointAddress{1234, 5}, 7}.ReleaseStorage();
+    const auto payloadSize = fullBlob.size() - SerializedMessage::SimMsgHeaderSize;
+
+    std::vector<uint8_t> compactBlob(CompactSimMsgHeaderMaxSize);
+    compactBlob.resize(WriteCompactSimMsgHeader(compactBlob.data(), 7, 5, payloadSize));
+    compactBlob.insert(compactBlob.end(), fullBlob.begin() + SerializedMessage::SimMsgHeaderSize, fullBlob.end());
+
+    uint32_t messageSize{0};
+    memcpy(&messageSize, compactBlob.data(), sizeof(uint32_t));
+    ASSERT_EQ(messageSize, compactBlob.size());
+    ASSERT_EQ(compactBlob.size(), payloadSize + 7);
+
+    SerializedMessage compactMsg{std::move(compactBlob)};
+    ASSERT_EQ(compactMsg.GetMessageKind(), VAsioMsgKind::SilKitSimMsg);
+    ASSERT_EQ(compactMsg.GetRemoteIndex(), EndpointId{7});
+    // the participant is implied by the peer which received the message
+    ASSERT_EQ(compactMsg.GetEndpointAddress().participant, ParticipantId{0});
+    ASSERT_EQ(compactMsg.GetEndpointAddress().endpoint, EndpointId{5});
+
+    const auto receivedLogMsg = compactMsg.Deserialize<SilKit::Services::Logging::LogMsg>();
+    ASSERT_EQ(receivedLogMsg.logger_name, logMsg.logger_name);
+    ASSERT_EQ(receivedLogMsg.payload, logMsg.payload);
+}
@@ -0,0 +1,169 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "SharedMemoryChannel.hpp"
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "silkit/participant/exception.hpp"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+class SharedMemoryChannelTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!SharedMemoryChannel::IsSupported())
+        {
+            GTEST_SKIP() << "Shared memory is not supported on this platform";
+        }
+    }
+};
+
+TEST_F(SharedMemoryChannelTest, rings_connect_creator_and_opener)
+{
+    auto creator = SharedMemoryChannel::Create(64);
+    auto opener = SharedMemoryChannel::Open(creator->GetName());
+
+    const std::vector<uint8_t> request{1, 2, 3};
+    ASSERT_EQ(creator->SendRing().Write(request.data(), request.size()), request.size());
+    std::vector<uint8_t> received(request.size());
+    ASSERT_EQ(opener->ReceiveRing().Read(received.data(), received.size()), request.size());
+    EXPECT_EQ(received, request);
+
+    const std::vector<uint8_t> reply{4, 5};
+    ASSERT_EQ(opener->SendRing().Write(reply.data(), reply.size()), reply.size());
+    received.resize(reply.size());
+    ASSERT_EQ(creator->ReceiveRing().Read(received.data(), received.size()), reply.size());
+    EXPECT_EQ(received, reply);
+}
+
+TEST_F(SharedMemoryChannelTest, writes_are_limited_by_capacity_and_wrap_around)
+{
+    auto creator = SharedMemoryChannel::Create(16);
+    auto opener = SharedMemoryChannel::Open(creator->GetName());
+    auto& writer = creator->SendRing();
+    auto& reader = opener->ReceiveRing();
+
+    std::vector<uint8_t> data(24);
+    std::iota(data.begin(), data.end(), uint8_t{0});
+    ASSERT_EQ(writer.Write(data.data(), data.size()), 16u);
+    EXPECT_EQ(writer.WritableBytes(), 0u);
+
+    std::vector<uint8_t> received(24);
+    ASSERT_EQ(reader.Read(received.data(), 10), 10u);
+    // the remaining bytes wrap around the end of the ring
+    ASSERT_EQ(writer.Write(data.data() + 16, 8), 8u);
+    ASSERT_EQ(reader.Read(received.data() + 10, 14), 14u);
+    EXPECT_EQ(received, data);
+    EXPECT_EQ(reader.ReadableBytes(), 0u);
+}
+
+TEST_F(SharedMemoryChannelTest, suspended_reader_and_writer_are_woken_up_once)
+{
+    auto creator = SharedMemoryChannel::Create(16);
+    auto opener = SharedMemoryChannel::Open(creator->GetName());
+    auto& writer = creator->SendRing();
+    auto& reader = opener->ReceiveRing();
+
+    std::vector<uint8_t> data(16);
+    // the reader of a new ring is suspended
+    ASSERT_EQ(writer.Write(data.data(), 1), 1u);
+    EXPECT_TRUE(writer.WakeReader());
+    ASSERT_EQ(writer.Write(data.data(), 1), 1u);
+    EXPECT_FALSE(writer.WakeReader());
+
+    // the reader is not suspended while data is available
+    EXPECT_FALSE(reader.SuspendReader());
+    ASSERT_EQ(reader.Read(data.data(), 2), 2u);
+    EXPECT_TRUE(reader.SuspendReader());
+
+    ASSERT_EQ(writer.Write(data.data(), 16), 16u);
+    EXPECT_TRUE(writer.WakeReader());
+    EXPECT_TRUE(writer.SuspendWriter());
+    ASSERT_EQ(reader.Read(data.data(), 1), 1u);
+    EXPECT_TRUE(reader.WakeWriter());
+    EXPECT_FALSE(reader.WakeWriter());
+}
+
+TEST_F(SharedMemoryChannelTest, byte_stream_is_transferred_between_threads)
+{
+    auto creator = SharedMemoryChannel::Create(256);
+    auto opener = SharedMemoryChannel::Open(creator->GetName());
+    auto& writer = creator->SendRing();
+    auto& reader = opener->ReceiveRing();
+
+    constexpr std::size_t numBytes = 1024 * 1024;
+    std::thread writerThread{[&writer] {
+        std::vector<uint8_t> chunk(100);
+        std::size_t written = 0;
+        while (written < numBytes)
+        {
+            const auto size = std::min(chunk.size(), numBytes - written);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                chunk[i] = static_cast<uint8_t>(written + i);
+            }
+            std::size_t offset = 0;
+            while (offset < size)
+            {
+                offset += writer.Write(chunk.data() + offset, size - offset);
+            }
+            written += size;
+        }
+    }};
+
+    std::vector<uint8_t> chunk(77);
+    std::size_t received = 0;
+    bool isValid = true;
+    while (received < numBytes)
+    {
+        const auto count = reader.Read(chunk.data(), chunk.size());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            isValid = isValid && chunk[i] == static_cast<uint8_t>(received + i);
+        }
+        received += count;
+    }
+    writerThread.join();
+
+    EXPECT_TRUE(isValid);
+    EXPECT_EQ(reader.ReadableBytes(), 0u);
+}
+
+TEST_F(SharedMemoryChannelTest, unlinked_or_foreign_segments_cannot_be_opened)
+{
+    auto creator = SharedMemoryChannel::Create(64);
+    const auto name = creator->GetName();
+    creator->Unlink();
+
+    EXPECT_THROW(SharedMemoryChannel::Open(name), SilKit::SilKitError);
+    EXPECT_THROW(SharedMemoryChannel::Open("/some-other-segment"), SilKit::SilKitError);
+}
+
+} // namespace
@@ -153,7 +153,17 @@ struct DummyVAsioPeerBase : IVAsioPeer
         throw MethodNotImplementedError{};
     }
 
-    void DrainAllBuffers() final
+    auto DrainAllBuffers() -> DrainStatistics final
+    {
+        throw MethodNotImplementedError{};
+    }
+
+    auto GetPeerStatistics() const -> PeerStatistics final
+    {
+        throw MethodNotImplementedError{};
+    }
+
+    void FlushSendBuffers() final
     {
         throw MethodNotImplementedError{};
     }
@@ -167,6 +177,11 @@ struct DummyVAsioPeerBase : IVAsioPeer
     {
         throw MethodNotImplementedError{};
     }
+
+    auto GetRemoteServiceEndpoint(EndpointId) -> std::shared_ptr<const RemoteServiceEndpoint> final
+    {
+        throw MethodNotImplementedError{};
+    }
 };
 
 struct AdvertisedVAsioPeer final : DummyVAsioPeerBase
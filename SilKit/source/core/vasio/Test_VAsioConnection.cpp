@@ -19,50 +19,18 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-// fowards required for TestDataTypes because of  SilKitMsgTraits
-#include "silkit/services/can/fwd_decl.hpp"
-#include "silkit/services/ethernet/fwd_decl.hpp"
-#include "silkit/services/flexray/fwd_decl.hpp"
-#include "silkit/services/lin/fwd_decl.hpp"
-#include "silkit/services/pubsub/fwd_decl.hpp"
-#include "silkit/services/rpc/fwd_decl.hpp"
-#include "silkit/services/orchestration/fwd_decl.hpp"
-#include "silkit/services/logging/fwd_decl.hpp"
-
-// internal types required for TestDataTypes because of SilKitMsgTraits
-#include "WireCanMessages.hpp"
-#include "WireDataMessages.hpp"
-#include "WireEthernetMessages.hpp"
-#include "WireFlexrayMessages.hpp"
-#include "WireLinMessages.hpp"
-#include "WireRpcMessages.hpp"
-
-#include "ServiceDatatypes.hpp" //concrete, no forwards
-#include "RequestReplyDatatypes.hpp" //concrete, no forwards
-#include "LoggingDatatypesInternal.hpp" //concrete, no forwards
-#include "OrchestrationDatatypes.hpp" //concrete, no forwards
-
-#include "ProtocolVersion.hpp"
-#include "TestDataTypes.hpp" // must be included before VAsioConnection
-
-#include "IVAsioPeer.hpp"
-#include "IMessageReceiver.hpp"
-
-#include "VAsioConnection.hpp"
-#include "MockParticipant.hpp" // for DummyLogger
-#include "VAsioSerdes.hpp"
-#include "SerializedMessage.hpp"
-#include "TimeProvider.hpp"
-
-#include "ILogger.hpp"
+#include "VAsioConnectionTestUtils.hpp"
 
 #include <chrono>
+#include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
 using namespace std::chrono_literals;
 using namespace SilKit::Core;
+using namespace SilKit::Core::Tests;
 
 using testing::Return;
 using testing::ReturnRef;
@@ -94,50 +62,6 @@ struct MockSilKitMessageReceiver
     MOCK_METHOD(const ServiceDescriptor&, GetServiceDescriptor, (), (override, const));
 };
 
-
-struct MockVAsioPeer
-    : public IVAsioPeer
-    , public IServiceEndpoint
-{
-    VAsioPeerInfo _peerInfo;
-    ServiceDescriptor _serviceDescriptor;
-    ProtocolVersion _protocolVersion;
-
-    MockVAsioPeer()
-    {
-        _peerInfo.participantId = 1234;
-        _peerInfo.participantName = "MockVAsioPeer";
-        _peerInfo.acceptorUris.push_back("tcp://localhost:1234");
-
-        _serviceDescriptor.SetServiceId(1);
-        _serviceDescriptor.SetParticipantNameAndComputeId(_peerInfo.participantName);
-
-        _protocolVersion = CurrentProtocolVersion();
-
-        ON_CALL(*this, GetLocalAddress()).WillByDefault(Return("127.0.0.1"));
-        ON_CALL(*this, GetRemoteAddress()).WillByDefault(Return("127.0.0.1"));
-        ON_CALL(*this, GetInfo()).WillByDefault(ReturnRef(_peerInfo));
-        ON_CALL(*this, GetServiceDescriptor()).WillByDefault(ReturnRef(_serviceDescriptor));
-        ON_CALL(*this, GetProtocolVersion()).WillByDefault(Return(_protocolVersion));
-    }
-
-    // IVasioPeer
-    MOCK_METHOD(void, SendSilKitMsg, (SerializedMessage), (override));
-    MOCK_METHOD(void, Subscribe, (VAsioMsgSubscriber), (override));
-    MOCK_METHOD(const VAsioPeerInfo&, GetInfo, (), (const, override));
-    MOCK_METHOD(void, SetInfo, (VAsioPeerInfo), (override));
-    MOCK_METHOD(std::string, GetRemoteAddress, (), (const, override));
-    MOCK_METHOD(std::string, GetLocalAddress, (), (const, override));
-    MOCK_METHOD(void, StartAsyncRead, (), (override));
-    MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
-    MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
-    MOCK_METHOD(void, DrainAllBuffers, (), (override));
-
-    // IServiceEndpoint
-    MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
-    MOCK_METHOD(const ServiceDescriptor&, GetServiceDescriptor, (), (override, const));
-};
-
 //////////////////////////////////////////////////////////////////////
 // Matchers
 //////////////////////////////////////////////////////////////////////
@@ -159,39 +83,31 @@ MATCHER_P(SubscriptionAcknowledgeMatcher, subscriber,
         ;
 }
 
-} // namespace
-
-//////////////////////////////////////////////////////////////////////
-// Test Fixture
-//////////////////////////////////////////////////////////////////////
-
-namespace SilKit {
-namespace Core {
-
-class VAsioConnectionTest : public testing::Test
+MATCHER_P(SubscriptionAcknowledgeBatchMatcher, subscribers,
+    "Deserialize the MessageBuffer from the SerializedMessage and check the acks of the subscription batch")
 {
-protected:
-    VAsioConnectionTest()
-        : _connection({}, "VAsioConnectionTest", 1, &_timeProvider)
+    SerializedMessage message = arg;
+    if (message.GetMessageKind() != VAsioMsgKind::SubscriptionAcknowledgeBatch)
     {
-        _connection.SetLogger(&_dummyLogger);
+        return false;
     }
-    Services::Orchestration::TimeProvider _timeProvider;
-    VAsioConnection _connection;
-    MockVAsioPeer _from;
-    Tests::MockLogger _dummyLogger;
-
-    //we are a friend class
-    // - allow selected access to private member
-    template<typename MessageT, typename ServiceT>
-    void RegisterSilKitMsgReceiver(SilKit::Core::IMessageReceiver<MessageT>* receiver)
+    auto reply = message.Deserialize<SubscriptionAcknowledgeBatch>();
+    if (reply.acknowledges.size() != subscribers.size())
     {
-        _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
+        return false;
     }
-};
+    for (size_t i = 0; i < subscribers.size(); ++i)
+    {
+        if (reply.acknowledges[i].status != SubscriptionAcknowledge::Status::Success
+            || !(reply.acknowledges[i].subscriber == subscribers[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-} // namespace Core
-} // namespace SilKit
+} // namespace
 
 //////////////////////////////////////////////////////////////////////
 // Versioned initial handshake
@@ -296,3 +212,336 @@ TEST_F(VAsioConnectionTest, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+TEST_F(VAsioConnectionTest, subscription_batch_is_acknowledged_in_a_single_message)
+{
+    auto makeSubscriber = [](auto message, EndpointId receiverIdx) {
+        using MessageTrait = SilKitMsgTraits<decltype(message)>;
+        VAsioMsgSubscriber subscriber;
+        subscriber.msgTypeName = MessageTrait::SerdesName();
+        subscriber.networkName = "unittest";
+        subscriber.version = MessageTrait::Version();
+        subscriber.receiverIdx = receiverIdx;
+        return subscriber;
+    };
+
+    std::vector<VAsioMsgSubscriber> subscribers{makeSubscriber(Tests::Version1::TestMessage{}, 0),
+                                                makeSubscriber(Tests::TestFrameEvent{}, 1)};
+
+    SubscriptionAnnouncementBatch batch;
+    batch.subscribers = subscribers;
+
+    EXPECT_CALL(_from, SendSilKitMsg(SubscriptionAcknowledgeBatchMatcher(subscribers))).Times(1);
+    _connection.OnSocketData(&_from, SerializedMessage{batch});
+}
+
+//////////////////////////////////////////////////////////////////////
+// Receiving messages from remote services
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(VAsioConnectionTest, received_messages_share_the_cached_sender_endpoint)
+{
+    MockSilKitMessageReceiver mockReceiver;
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, MockSilKitMessageReceiver>(&mockReceiver);
+
+    auto senderAddress = _from.GetServiceDescriptor().to_endpointAddress();
+    senderAddress.endpoint = 42;
+
+    std::vector<const IServiceEndpoint*> senders;
+    EXPECT_CALL(mockReceiver, ReceiveMsg(_, testing::An<const Tests::TestFrameEvent&>()))
+        .Times(2)
+        .WillRepeatedly([&senders](const IServiceEndpoint* from, const Tests::TestFrameEvent&) {
+            senders.push_back(from);
+        });
+    EXPECT_CALL(_from, GetRemoteServiceEndpoint(42)).Times(2);
+
+    _connection.OnSocketData(&_from, SerializedMessage(Tests::TestFrameEvent{}, senderAddress, 0));
+    _connection.OnSocketData(&_from, SerializedMessage(Tests::TestFrameEvent{}, senderAddress, 0));
+
+    ASSERT_EQ(senders.size(), 2u);
+    EXPECT_EQ(senders[0], senders[1]);
+    EXPECT_EQ(senders[0]->GetServiceDescriptor().GetServiceId(), 42u);
+    EXPECT_EQ(senders[0]->GetServiceDescriptor().GetParticipantName(), _from._peerInfo.participantName);
+    EXPECT_EQ(_from._remoteServiceEndpoints.Size(), 1u);
+}
+
+TEST_F(VAsioConnectionTest, clearing_the_remote_service_endpoints_rebuilds_them)
+{
+    RemoteServiceEndpointCache cache;
+    ServiceDescriptor peerDescriptor{"Peer", "Network", "Service", 1};
+
+    const auto first = cache.Get(peerDescriptor, 7);
+    EXPECT_EQ(cache.Get(peerDescriptor, 7), first);
+    EXPECT_EQ(first->GetServiceDescriptor().GetServiceId(), 7u);
+    EXPECT_EQ(first->GetServiceDescriptor().GetNetworkName(), "Network");
+
+    peerDescriptor.SetNetworkName("OtherNetwork");
+    cache.Clear();
+
+    const auto second = cache.Get(peerDescriptor, 7);
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->GetServiceDescriptor().GetNetworkName(), "OtherNetwork");
+    // endpoints handed out before clearing stay valid
+    EXPECT_EQ(first->GetServiceDescriptor().GetNetworkName(), "Network");
+}
+
+TEST_F(VAsioConnectionTest, remote_service_endpoints_are_built_once_by_concurrent_readers)
+{
+    RemoteServiceEndpointCache cache;
+    const ServiceDescriptor peerDescriptor{"Peer", "Network", "Service", 1};
+
+    // small ids are looked up without locking, large ids are looked up under the lock
+    const std::vector<EndpointId> endpointIds{0, 1, 255, 256, 100000};
+
+    std::vector<std::vector<std::shared_ptr<const RemoteServiceEndpoint>>> endpoints(4);
+    std::vector<std::thread> readers;
+    for (auto& readerEndpoints : endpoints)
+    {
+        readers.emplace_back([&cache, &peerDescriptor, &endpointIds, &readerEndpoints] {
+            for (auto i = 0; i < 1000; ++i)
+            {
+                for (auto endpointId : endpointIds)
+                {
+                    readerEndpoints.push_back(cache.Get(peerDescriptor, endpointId));
+                }
+            }
+        });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(cache.Size(), endpointIds.size());
+    for (size_t i = 0; i < endpointIds.size(); ++i)
+    {
+        const auto& endpoint = endpoints[0][i];
+        EXPECT_EQ(endpoint->GetServiceDescriptor().GetServiceId(), endpointIds[i]);
+        for (const auto& readerEndpoints : endpoints)
+        {
+            for (size_t k = i; k < readerEndpoints.size(); k += endpointIds.size())
+            {
+                ASSERT_EQ(readerEndpoints[k], endpoint);
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Sending messages via the links of the services
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(VAsioConnectionTest, sending_uses_the_link_of_the_senders_network)
+{
+    CountingTestFrameEventReceiver receiverA{"A"};
+    CountingTestFrameEventReceiver receiverB{"B"};
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiverA);
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiverB);
+
+    TestServiceEndpoint senderA{"A", 0};
+    TestServiceEndpoint senderB{"B", 1};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&senderA);
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&senderB);
+
+    SendMsgImpl(&senderA, Tests::TestFrameEvent{});
+    SendMsgImpl(&senderB, Tests::TestFrameEvent{});
+    SendMsgImpl(&senderB, Tests::TestFrameEvent{});
+
+    EXPECT_EQ(receiverA.numReceived, 1u);
+    EXPECT_EQ(receiverB.numReceived, 2u);
+
+    // an endpoint which was not registered as sender uses the link of its network
+    TestServiceEndpoint unregisteredSender{"A", 1};
+    SendMsgImpl(&unregisteredSender, Tests::TestFrameEvent{});
+    EXPECT_EQ(receiverA.numReceived, 2u);
+
+    // a simulator is registered once per simulated network, with the same endpoint
+    TestServiceEndpoint simulator{"A", 2};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&simulator);
+    simulator._serviceDescriptor.SetNetworkName("B");
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&simulator);
+
+    simulator._serviceDescriptor.SetNetworkName("A");
+    SendMsgImpl(&simulator, Tests::TestFrameEvent{});
+    EXPECT_EQ(receiverA.numReceived, 3u);
+    EXPECT_EQ(receiverB.numReceived, 2u);
+
+    TestServiceEndpoint senderOnUnknownNetwork{"C", 3};
+    EXPECT_THROW(SendMsgImpl(&senderOnUnknownNetwork, Tests::TestFrameEvent{}), SilKit::SilKitError);
+}
+
+TEST_F(VAsioConnectionTest, sender_whose_network_changed_uses_the_link_of_its_new_network)
+{
+    std::vector<std::unique_ptr<TestServiceEndpoint>> services;
+    for (EndpointId i = 0; i < 64; ++i)
+    {
+        services.emplace_back(std::make_unique<TestServiceEndpoint>("Network/" + std::to_string(i), i));
+        RegisterSilKitMsgSender<Tests::TestFrameEvent>(services.back().get());
+    }
+
+    const auto networkName = services.back()->GetServiceDescriptor().GetNetworkName();
+    CountingTestFrameEventReceiver receiver{networkName, 64};
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiver);
+
+    SendMsgImpl(services.back().get(), Tests::TestFrameEvent{});
+    EXPECT_EQ(receiver.numReceived, 1u);
+
+    // the link handle of the registration is not used once the network of the sender changed
+    services.front()->_serviceDescriptor.SetNetworkName(networkName);
+    SendMsgImpl(services.front().get(), Tests::TestFrameEvent{});
+    EXPECT_EQ(receiver.numReceived, 2u);
+}
+
+TEST_F(VAsioConnectionTest, local_fan_out_skips_the_sender)
+{
+    std::vector<std::unique_ptr<CountingTestFrameEventReceiver>> controllers;
+    for (EndpointId i = 0; i < 200; ++i)
+    {
+        controllers.emplace_back(std::make_unique<CountingTestFrameEventReceiver>("CanNetwork", i));
+        RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(controllers.back().get());
+    }
+
+    const auto& sender = *controllers.front();
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    SendMsgImpl(&sender, Tests::TestFrameEvent{});
+    SendMsgImpl(&sender, Tests::TestFrameEvent{});
+
+    EXPECT_EQ(controllers.front()->numReceived, 0u);
+    for (size_t i = 1; i < controllers.size(); ++i)
+    {
+        EXPECT_EQ(controllers[i]->numReceived, 2u);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Registry as fallback proxy
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(VAsioConnectionTest, proxy_messages_are_relayed_as_received)
+{
+    ProxiedParticipantPeer source{"Source"};
+    ProxiedParticipantPeer destination{"Destination"};
+    AddParticipantPeer(&source);
+    AddParticipantPeer(&destination);
+
+    const auto blob = MakeProxyMessageBlob("Source", "Destination", 100);
+    _connection.OnSocketData(&source, SerializedMessage{std::vector<uint8_t>{blob}});
+
+    ASSERT_TRUE(source.sentMessages.empty());
+    ASSERT_EQ(destination.sentMessages.size(), 1u);
+    EXPECT_EQ(destination.sentMessages.front(), blob);
+}
+
+TEST_F(VAsioConnectionTest, lazy_peer_relays_all_messages_without_a_data_connection)
+{
+    SilentLogger logger;
+    ProxiedParticipantPeer registry{"Registry"};
+
+    // the remote participant does not accept data connections
+    VAsioPeerInfo peerInfo{"Other", 2, {}, {}};
+    VAsioLazyPeer lazyPeer{&_connection, peerInfo, &registry, &logger};
+
+    SerializedMessage broadcastMsg{Tests::TestFrameEvent{}, EndpointAddress{1, 2}, 3};
+    broadcastMsg.SetIsBroadcastMsg(true);
+    lazyPeer.SendSilKitMsg(std::move(broadcastMsg));
+    lazyPeer.SendSilKitMsg(SerializedMessage{Tests::TestFrameEvent{}, EndpointAddress{1, 2}, 3});
+
+    EXPECT_EQ(lazyPeer.GetDataConnection(), nullptr);
+    ASSERT_EQ(registry.sentMessages.size(), 2u);
+    for (auto& sentMessage : registry.sentMessages)
+    {
+        SerializedMessage message{std::move(sentMessage)};
+        ASSERT_EQ(message.GetMessageKind(), VAsioMsgKind::SilKitProxyMessage);
+        const auto routing = message.PeekProxyMessageRouting();
+        EXPECT_EQ(routing.source, "VAsioConnectionTest");
+        EXPECT_EQ(routing.destination, "Other");
+    }
+}
+
+TEST_F(VAsioConnectionTest, relayed_participant_gets_a_lazy_peer_only_if_it_advertises_lazy_peer_connections)
+{
+    SilentLogger logger;
+    ProxiedParticipantPeer registry{"Registry"};
+
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.enableLazyPeerConnections = true;
+    config.middleware.registryAsFallbackProxy = true;
+    VAsioConnection connection{config, "Destination", 1, &_timeProvider};
+    connection.SetLogger(&logger);
+
+    const auto receiveRelayedAnnouncement = [&connection, &registry](const std::string& source,
+                                                                     const std::string& capabilities) {
+        ParticipantAnnouncement announcement;
+        announcement.peerInfo.participantName = source;
+        announcement.peerInfo.capabilities = capabilities;
+
+        ProxyMessage proxyMessage{};
+        proxyMessage.source = source;
+        proxyMessage.destination = "Destination";
+        proxyMessage.payload = SerializedMessage{announcement}.ReleaseStorage();
+        connection.OnSocketData(&registry, SerializedMessage{proxyMessage});
+    };
+
+    VAsioCapabilities lazyCapabilities;
+    lazyCapabilities.AddCapability("proxy-message");
+    lazyCapabilities.AddCapability("lazy-peer-connections");
+    receiveRelayedAnnouncement("Lazy", lazyCapabilities.ToCapabilitiesString());
+
+    VAsioCapabilities proxyCapabilities;
+    proxyCapabilities.AddCapability("proxy-message");
+    receiveRelayedAnnouncement("Proxied", proxyCapabilities.ToCapabilitiesString());
+
+    auto* lazyPeer = FindParticipantPeer(connection, "Lazy");
+    ASSERT_NE(lazyPeer, nullptr);
+    EXPECT_NE(dynamic_cast<VAsioLazyPeer*>(lazyPeer), nullptr);
+
+    // a participant of a different version or configuration does not accept data connections
+    auto* proxiedPeer = FindParticipantPeer(connection, "Proxied");
+    ASSERT_NE(proxiedPeer, nullptr);
+    EXPECT_EQ(dynamic_cast<VAsioLazyPeer*>(proxiedPeer), nullptr);
+    EXPECT_NE(dynamic_cast<VAsioProxyPeer*>(proxiedPeer), nullptr);
+}
+
+TEST_F(VAsioConnectionTest, lazy_peer_sends_control_messages_after_the_data_via_the_data_connection)
+{
+    SilentLogger logger;
+    ProxiedParticipantPeer registry{"Registry"};
+
+    VAsioPeerInfo peerInfo{"Other", 2, {}, {}};
+    VAsioLazyPeer lazyPeer{&_connection, peerInfo, &registry, &logger};
+
+    // the remote participant opened the data connection
+    auto dataConnection = std::make_shared<ProxiedParticipantPeer>("Other");
+    lazyPeer.OnDataConnectionEstablished(dataConnection);
+    ASSERT_EQ(lazyPeer.GetDataConnection(), dataConnection);
+
+    Tests::TestFrameEvent frameEvent{};
+    frameEvent.str = "queued before the next simulation step";
+    lazyPeer.SendSilKitMsg(SerializedMessage{frameEvent, EndpointAddress{1, 2}, 3});
+
+    const SilKit::Services::Orchestration::NextSimTask nextSimTask{1ms, 1ms};
+    SerializedMessage nextSimTaskMsg{nextSimTask, EndpointAddress{1, 4}, 5};
+    nextSimTaskMsg.SetIsControlMsg(true);
+    lazyPeer.SendSilKitMsg(std::move(nextSimTaskMsg));
+
+    // both messages take the same connection, the data message is delivered before the next simulation step
+    EXPECT_TRUE(registry.sentMessages.empty());
+    ASSERT_EQ(dataConnection->sentMessages.size(), 2u);
+
+    SerializedMessage receivedFrameEvent{std::move(dataConnection->sentMessages[0])};
+    EXPECT_EQ(receivedFrameEvent.Deserialize<Tests::TestFrameEvent>().str, frameEvent.str);
+    SerializedMessage receivedNextSimTask{std::move(dataConnection->sentMessages[1])};
+    EXPECT_EQ(receivedNextSimTask.Deserialize<SilKit::Services::Orchestration::NextSimTask>().timePoint,
+              nextSimTask.timePoint);
+}
+TEST_F(VAsioConnectionTest, received_data_is_handed_to_the_connection_strand_before_the_io_workers_started)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.ioWorkerThreads = 2;
+    VAsioConnection connection{config, "VAsioConnectionTest", 1, &_timeProvider};
+
+    // the number of IO workers is known before any of them is started
+    EXPECT_TRUE(IsOffConnectionStrand(connection));
+    EXPECT_FALSE(IsOffConnectionStrand(_connection));
+}
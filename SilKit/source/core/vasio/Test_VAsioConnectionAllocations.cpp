@@ -0,0 +1,342 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioConnectionTestUtils.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+using namespace SilKit::Core::Tests;
+
+namespace {
+
+std::atomic_bool gCountAllocations{false};
+std::atomic<size_t> gNumAllocations{0};
+
+auto CountAllocation(std::size_t size) noexcept -> void*
+{
+    if (gCountAllocations)
+    {
+        ++gNumAllocations;
+    }
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+auto CountAllocationOrThrow(std::size_t size) -> void*
+{
+    if (auto* ptr = CountAllocation(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+#if defined(__cpp_aligned_new)
+auto CountAlignedAllocation(std::size_t size, std::align_val_t alignment) noexcept -> void*
+{
+    if (gCountAllocations)
+    {
+        ++gNumAllocations;
+    }
+#if defined(_WIN32)
+    return _aligned_malloc(size == 0 ? 1 : size, static_cast<std::size_t>(alignment));
+#else
+    void* ptr{nullptr};
+    if (posix_memalign(&ptr, static_cast<std::size_t>(alignment), size == 0 ? 1 : size) != 0)
+    {
+        return nullptr;
+    }
+    return ptr;
+#endif
+}
+
+auto CountAlignedAllocationOrThrow(std::size_t size, std::align_val_t alignment) -> void*
+{
+    if (auto* ptr = CountAlignedAllocation(size, alignment))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void FreeAligned(void* ptr) noexcept
+{
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+#endif
+
+} // namespace
+
+// Count the allocations of the allocation benchmarks, all other allocations pass through unchanged. The replacement is
+// global for the executable, which is why these benchmarks do not share it with the other tests of the VAsioConnection.
+void* operator new(std::size_t size)
+{
+    return CountAllocationOrThrow(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountAllocationOrThrow(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountAllocation(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountAllocation(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+#if defined(__cpp_aligned_new)
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountAlignedAllocationOrThrow(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountAlignedAllocationOrThrow(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountAlignedAllocation(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountAlignedAllocation(size, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAligned(ptr);
+}
+#endif
+
+// Micro benchmark: allocations on the receive path of a message from a known remote service. Besides deserializing the
+// message (which is allocation free for the short string of the TestFrameEvent), nothing may allocate per message.
+TEST_F(VAsioConnectionTest, benchmark_allocations_per_received_message)
+{
+    constexpr size_t numMessages = 10000;
+
+    SilentLogger logger;
+    _connection.SetLogger(&logger);
+
+    CountingTestFrameEventReceiver receiver;
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiver);
+
+    BenchmarkVAsioPeer peer;
+    auto senderAddress = peer.GetServiceDescriptor().to_endpointAddress();
+    senderAddress.endpoint = 42;
+
+    std::vector<SerializedMessage> messages;
+    messages.reserve(numMessages + 1);
+    for (size_t i = 0; i < numMessages + 1; ++i)
+    {
+        messages.emplace_back(Tests::TestFrameEvent{}, senderAddress, 0);
+    }
+
+    // the first message from the remote service builds its endpoint
+    _connection.OnSocketData(&peer, std::move(messages[0]));
+
+    gNumAllocations = 0;
+    gCountAllocations = true;
+    for (size_t i = 1; i < numMessages + 1; ++i)
+    {
+        _connection.OnSocketData(&peer, std::move(messages[i]));
+    }
+    gCountAllocations = false;
+
+    const auto allocationsPerMessage = static_cast<double>(gNumAllocations) / numMessages;
+    std::cout << "allocations per received message: " << allocationsPerMessage << std::endl;
+
+    EXPECT_EQ(receiver.numReceived, numMessages + 1);
+    EXPECT_LT(allocationsPerMessage, 0.01);
+
+    _connection.SetLogger(&_dummyLogger);
+}
+
+// Micro benchmark: allocations of handing messages sent by a user thread to the IO worker, in batches like the messages
+// of a simulation step. The message is copied into the posted handler, whose memory is recycled once the pool holds
+// enough blocks for a batch.
+TEST_F(VAsioConnectionTest, benchmark_allocations_per_sent_message)
+{
+    constexpr size_t numBatches = 100;
+    constexpr size_t numMessagesPerBatch = 100;
+    constexpr size_t numMessages = numBatches * numMessagesPerBatch;
+
+    SilentLogger logger;
+    _connection.SetLogger(&logger);
+
+    CountingTestFrameEventReceiver receiver{"BenchmarkNetwork", 1};
+    RegisterSilKitMsgReceiver<Tests::TestFrameEvent, CountingTestFrameEventReceiver>(&receiver);
+
+    TestServiceEndpoint sender{"BenchmarkNetwork", 0};
+    RegisterSilKitMsgSender<Tests::TestFrameEvent>(&sender);
+
+    // the pending accept keeps the IO worker running
+    _connection.AcceptTcpConnectionsOn("127.0.0.1", 0);
+    _connection.StartIoWorker();
+
+    const Tests::TestFrameEvent msg{};
+    auto sendBatches = [this, &sender, &receiver, &msg]() {
+        for (size_t batch = 0; batch < numBatches; ++batch)
+        {
+            const auto expected = receiver.numReceived + numMessagesPerBatch;
+            for (size_t i = 0; i < numMessagesPerBatch; ++i)
+            {
+                _connection.SendMsg(&sender, msg);
+            }
+            while (receiver.numReceived != expected)
+            {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    sendBatches();
+
+    gNumAllocations = 0;
+    gCountAllocations = true;
+    sendBatches();
+    gCountAllocations = false;
+
+    const auto allocationsPerMessage = static_cast<double>(gNumAllocations) / numMessages;
+    std::cout << "allocations per sent message: " << allocationsPerMessage << std::endl;
+
+    EXPECT_LT(allocationsPerMessage, 0.01);
+
+    _connection.SetLogger(&_dummyLogger);
+}
+
+// Micro benchmark: allocations of the registry relaying messages between two participants, which can only reach each
+// other through the registry. Only the routing information of each message is deserialized, the received buffer is
+// forwarded as-is.
+TEST_F(VAsioConnectionTest, benchmark_allocations_per_relayed_message)
+{
+    constexpr size_t numMessages = 10000;
+
+    SilentLogger logger;
+    _connection.SetLogger(&logger);
+
+    ProxiedParticipantPeer source{"Source"};
+    ProxiedParticipantPeer destination{"Destination"};
+    destination.recordSentMessages = false;
+    AddParticipantPeer(&source);
+    AddParticipantPeer(&destination);
+
+    const auto blob = MakeProxyMessageBlob("Source", "Destination", 1024);
+    std::vector<SerializedMessage> messages;
+    messages.reserve(numMessages + 1);
+    for (size_t i = 0; i < numMessages + 1; ++i)
+    {
+        messages.emplace_back(std::vector<uint8_t>{blob});
+    }
+
+    // the first message records the association between source and destination
+    _connection.OnSocketData(&source, std::move(messages[0]));
+
+    gNumAllocations = 0;
+    gCountAllocations = true;
+    for (size_t i = 1; i < numMessages + 1; ++i)
+    {
+        _connection.OnSocketData(&source, std::move(messages[i]));
+    }
+    gCountAllocations = false;
+
+    std::cout << "allocations per relayed message: " << static_cast<double>(gNumAllocations) / numMessages
+              << std::endl;
+
+    EXPECT_EQ(gNumAllocations, 0u);
+
+    _connection.SetLogger(&_dummyLogger);
+}
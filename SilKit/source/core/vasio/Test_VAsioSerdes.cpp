@@ -105,6 +105,35 @@ TEST(MwVAsioSerdes, vasio_VasioMsgSubscribers)
 
     EXPECT_EQ(in, out);
 }
+TEST(MwVAsioSerdes, vasio_subscriptionBatches)
+{
+    MessageBuffer buffer;
+    SubscriptionAnnouncementBatch inAnnouncements{}, outAnnouncements{};
+    SubscriptionAcknowledgeBatch inAcknowledges{}, outAcknowledges{};
+
+    for (auto i = 0; i < 10; i++)
+    {
+        auto subscriber = MakeSubscriber();
+        subscriber.receiverIdx = i;
+        inAnnouncements.subscribers.push_back(subscriber);
+        inAcknowledges.acknowledges.push_back({SubscriptionAcknowledge::Status::Success, subscriber});
+    }
+    inAcknowledges.acknowledges.back().status = SubscriptionAcknowledge::Status::Failed;
+
+    Serialize(buffer, inAnnouncements);
+    Serialize(buffer, inAcknowledges);
+    Deserialize(buffer, outAnnouncements);
+    Deserialize(buffer, outAcknowledges);
+
+    EXPECT_EQ(inAnnouncements.subscribers, outAnnouncements.subscribers);
+    ASSERT_EQ(inAcknowledges.acknowledges.size(), outAcknowledges.acknowledges.size());
+    for (size_t i = 0; i < inAcknowledges.acknowledges.size(); ++i)
+    {
+        EXPECT_EQ(inAcknowledges.acknowledges[i].status, outAcknowledges.acknowledges[i].status);
+        EXPECT_EQ(inAcknowledges.acknowledges[i].subscriber, outAcknowledges.acknowledges[i].subscriber);
+    }
+}
+
 TEST(MwVAsioSerdes, vasio_participantAnouncementReply)
 {
     MessageBuffer buffer;
@@ -143,4 +172,20 @@ TEST(MwVAsioSerdes, vasio_knownParticipants)
     EXPECT_EQ(in, out);
 }
 
+TEST(MwVAsioSerdes, vasio_sharedMemoryMessage)
+{
+    MessageBuffer buffer;
+    SharedMemoryMessage in{};
+    SharedMemoryMessage out{};
+
+    in.kind = SharedMemoryMessageKind::Announcement;
+    in.segmentName = "/SilKit-1234-1";
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(in.kind, out.kind);
+    EXPECT_EQ(in.segmentName, out.segmentName);
+}
+
 } // namespace
@@ -0,0 +1,622 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioTcpPeer.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "VAsioConnection.hpp"
+#include "MockParticipant.hpp" // for MockLogger
+#include "TimeProvider.hpp"
+#include "LoggingDatatypesInternal.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+namespace {
+
+using namespace SilKit::Core;
+
+class VAsioTcpPeerTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _acceptor.open(asio::ip::tcp::v4());
+        _acceptor.bind(asio::ip::tcp::endpoint{asio::ip::address_v4::loopback(), 0});
+        _acceptor.listen();
+    }
+
+    auto MakeConnectedPeer(SilKit::Config::ParticipantConfiguration config) -> std::shared_ptr<VAsioTcpPeer>
+    {
+        _connection = std::make_unique<VAsioConnection>(std::move(config), "VAsioTcpPeerTest", 1, &_timeProvider);
+        _connection->SetLogger(&_logger);
+
+        auto peer = VAsioTcpPeer::Create(_ioContext.get_executor(), _connection.get(), &_logger);
+        peer->Socket().connect(asio::generic::stream_protocol::endpoint{_acceptor.local_endpoint()});
+        _acceptor.accept(_remoteSocket);
+        return peer;
+    }
+
+    auto MakeMessage(const std::string& payload) -> SerializedMessage
+    {
+        SilKit::Services::Logging::LogMsg logMsg;
+        logMsg.logger_name = "VAsioTcpPeerTest";
+        logMsg.payload = payload;
+        return SerializedMessage{logMsg, EndpointAddress{1, 2}, 3};
+    }
+
+    auto ReadRemoteMessage() -> SilKit::Services::Logging::LogMsg
+    {
+        SerializedMessage message{ReadRemoteMessageData()};
+        return message.Deserialize<SilKit::Services::Logging::LogMsg>();
+    }
+
+    auto ReadRemoteMessageData() -> std::vector<uint8_t>
+    {
+        auto data = ReadRemote(sizeof(uint32_t));
+        uint32_t messageSize{0};
+        memcpy(&messageSize, data.data(), sizeof(uint32_t));
+        auto remainder = ReadRemote(messageSize - sizeof(uint32_t));
+        data.insert(data.end(), remainder.begin(), remainder.end());
+        return data;
+    }
+
+    void WriteRemote(const std::vector<uint8_t>& data)
+    {
+        asio::write(_remoteSocket, asio::buffer(data));
+    }
+
+    void RunUntilReceived(const std::shared_ptr<VAsioTcpPeer>& peer, uint64_t numReceivedMessages)
+    {
+        while (peer->GetReceiveStatistics().numReceivedMessages < numReceivedMessages)
+        {
+            _ioContext.run_one();
+        }
+    }
+
+    // The connection starts buffering on its strand, which is run once by an IO worker of the connection
+    void StartSendBuffering()
+    {
+        _connection->StartSendBuffering();
+        _connection->StartIoWorker();
+        while (!_connection->IsBufferingSends())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    auto ReadRemote(std::size_t size) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> data(size);
+        asio::read(_remoteSocket, asio::buffer(data));
+        return data;
+    }
+
+protected:
+    asio::io_context _ioContext;
+    asio::ip::tcp::acceptor _acceptor{_ioContext};
+    asio::ip::tcp::socket _remoteSocket{_ioContext};
+    SilKit::Services::Orchestration::TimeProvider _timeProvider;
+    testing::NiceMock<SilKit::Core::Tests::MockLogger> _logger;
+    std::unique_ptr<VAsioConnection> _connection;
+};
+
+TEST_F(VAsioTcpPeerTest, batched_write_combines_queued_messages)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.batchedWriteMaxBytes = 1024 * 1024;
+    auto peer = MakeConnectedPeer(config);
+
+    // the messages are queued until the io context runs, then they are written in a single batch
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    auto sharedStorage = MakeMessage("shared").ReleaseSharedStorage();
+    for (EndpointId remoteIndex : {4, 5})
+    {
+        auto blob = SerializedMessage{sharedStorage, remoteIndex}.ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{sharedStorage, remoteIndex});
+    }
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 12u);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 1u);
+}
+
+TEST_F(VAsioTcpPeerTest, batched_write_respects_buffer_limit)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.batchedWriteMaxBytes = 1024 * 1024;
+    config.middleware.batchedWriteMaxBuffers = 4;
+    auto peer = MakeConnectedPeer(config);
+
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 10u);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 3u);
+}
+
+TEST_F(VAsioTcpPeerTest, unbatched_write_per_message)
+{
+    auto peer = MakeConnectedPeer({});
+
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 10u);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 10u);
+}
+
+TEST_F(VAsioTcpPeerTest, concurrent_senders_keep_their_message_order)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.batchedWriteMaxBytes = 1024 * 1024;
+    auto peer = MakeConnectedPeer(config);
+
+    constexpr int numSenders = 4;
+    constexpr int numMessagesPerSender = 100;
+
+    std::vector<std::thread> senders;
+    for (auto sender = 0; sender < numSenders; ++sender)
+    {
+        senders.emplace_back([this, &peer, sender] {
+            for (auto i = 0; i < numMessagesPerSender; ++i)
+            {
+                peer->SendSilKitMsg(MakeMessage(std::to_string(sender) + ":" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+
+    _ioContext.run();
+
+    std::vector<int> nextMessage(numSenders, 0);
+    for (auto n = 0; n < numSenders * numMessagesPerSender; ++n)
+    {
+        auto data = ReadRemote(sizeof(uint32_t));
+        uint32_t messageSize{0};
+        memcpy(&messageSize, data.data(), sizeof(uint32_t));
+        auto remainder = ReadRemote(messageSize - sizeof(uint32_t));
+        data.insert(data.end(), remainder.begin(), remainder.end());
+
+        SerializedMessage message{std::move(data)};
+        const auto payload = message.Deserialize<SilKit::Services::Logging::LogMsg>().payload;
+        const auto separator = payload.find(':');
+        const auto sender = std::stoi(payload.substr(0, separator));
+        EXPECT_EQ(std::stoi(payload.substr(separator + 1)), nextMessage[sender]);
+        nextMessage[sender]++;
+    }
+    EXPECT_EQ(nextMessage, std::vector<int>(numSenders, numMessagesPerSender));
+    EXPECT_EQ(peer->GetPeerStatistics().numSentMessages, static_cast<uint64_t>(numSenders * numMessagesPerSender));
+}
+
+TEST_F(VAsioTcpPeerTest, coalesced_messages_are_written_on_flush)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.enableMessageCoalescing = true;
+    auto peer = MakeConnectedPeer(config);
+
+    StartSendBuffering();
+
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    _ioContext.run();
+    _ioContext.restart();
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 0u);
+
+    peer->FlushSendBuffers();
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 10u);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 1u);
+}
+
+TEST_F(VAsioTcpPeerTest, coalesced_messages_are_written_when_exceeding_max_bytes)
+{
+    const auto messageSize = MakeMessage("x").ReleaseStorage().size();
+
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.enableMessageCoalescing = true;
+    config.middleware.messageCoalescingMaxBytes = static_cast<int>(4 * messageSize);
+    auto peer = MakeConnectedPeer(config);
+
+    StartSendBuffering();
+
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 10; ++i)
+    {
+        auto blob = MakeMessage("x").ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+        _ioContext.run();
+        _ioContext.restart();
+    }
+
+    // every fourth message triggers a write of the messages held back so far
+    EXPECT_EQ(ReadRemote(8 * messageSize), std::vector<uint8_t>(expected.begin(), expected.begin() + 8 * messageSize));
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 2u);
+
+    peer->FlushSendBuffers();
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(2 * messageSize), std::vector<uint8_t>(expected.begin() + 8 * messageSize, expected.end()));
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 3u);
+}
+
+TEST_F(VAsioTcpPeerTest, coalesced_messages_are_not_written_with_messages_sent_before)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.enableMessageCoalescing = true;
+    auto peer = MakeConnectedPeer(config);
+
+    // the write of the first message starts only after the buffering, it must not pick up the held back messages
+    const auto first = MakeMessage("first").ReleaseStorage();
+    peer->SendSilKitMsg(SerializedMessage{first});
+
+    StartSendBuffering();
+    for (auto i = 0; i < 3; ++i)
+    {
+        peer->SendSilKitMsg(MakeMessage(std::to_string(i)));
+    }
+
+    _ioContext.run();
+    _ioContext.restart();
+    EXPECT_EQ(ReadRemote(first.size()), first);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 1u);
+
+    peer->FlushSendBuffers();
+    _ioContext.run();
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(ReadRemoteMessage().payload, std::to_string(i));
+    }
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 4u);
+    EXPECT_EQ(peer->GetWriteStatistics().numWrites, 2u);
+}
+
+TEST_F(VAsioTcpPeerTest, control_messages_are_written_ahead_of_bulk_messages)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.prioritizeControlMessages = true;
+    auto peer = MakeConnectedPeer(config);
+
+    std::vector<uint8_t> expectedBulk;
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expectedBulk.insert(expectedBulk.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    auto controlMessage = MakeMessage("control");
+    controlMessage.SetIsControlMsg(true);
+    auto expected = MakeMessage("control").ReleaseStorage();
+    peer->SendSilKitMsg(std::move(controlMessage));
+
+    _ioContext.run();
+
+    expected.insert(expected.end(), expectedBulk.begin(), expectedBulk.end());
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+}
+
+TEST_F(VAsioTcpPeerTest, control_messages_keep_their_order_if_not_prioritized)
+{
+    auto peer = MakeConnectedPeer({});
+
+    std::vector<uint8_t> expected;
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        expected.insert(expected.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    auto controlMessage = MakeMessage("control");
+    controlMessage.SetIsControlMsg(true);
+    auto blob = MakeMessage("control").ReleaseStorage();
+    expected.insert(expected.end(), blob.begin(), blob.end());
+    peer->SendSilKitMsg(std::move(controlMessage));
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemote(expected.size()), expected);
+}
+
+TEST_F(VAsioTcpPeerTest, receive_reuses_message_buffers)
+{
+    auto peer = MakeConnectedPeer({});
+    peer->StartAsyncRead();
+
+    // the messages are addressed to an unknown receiver and are ignored by the connection
+    std::vector<uint8_t> data;
+    for (auto i = 0; i < 100; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+    WriteRemote(data);
+    RunUntilReceived(peer, 100);
+
+    // the initial receive buffer, the first message buffer, and possibly one message buffer growing in size
+    EXPECT_LE(peer->GetReceiveStatistics().numAllocations, 3u);
+
+    const auto numAllocations = peer->GetReceiveStatistics().numAllocations;
+    WriteRemote(data);
+    RunUntilReceived(peer, 200);
+    EXPECT_EQ(peer->GetReceiveStatistics().numAllocations, numAllocations);
+}
+
+TEST_F(VAsioTcpPeerTest, receive_message_larger_than_receive_buffer)
+{
+    auto peer = MakeConnectedPeer({});
+    peer->StartAsyncRead();
+
+    std::vector<uint8_t> data;
+    for (const auto payloadSize : {10, 100 * 1024, 10})
+    {
+        auto blob = MakeMessage(std::string(payloadSize, 'x')).ReleaseStorage();
+        data.insert(data.end(), blob.begin(), blob.end());
+    }
+    WriteRemote(data);
+    RunUntilReceived(peer, 3);
+
+    EXPECT_EQ(peer->GetReceiveStatistics().numReceivedMessages, 3u);
+}
+
+TEST_F(VAsioTcpPeerTest, send_queue_drop_oldest_drops_only_droppable_messages)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueMaxMessages = 4;
+    config.middleware.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::DropOldest;
+    auto peer = MakeConnectedPeer(config);
+
+    peer->SendSilKitMsg(MakeMessage("reliable"));
+    for (auto i = 0; i < 9; ++i)
+    {
+        auto message = MakeMessage(std::to_string(i));
+        message.SetIsDroppableMsg(true);
+        peer->SendSilKitMsg(std::move(message));
+    }
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemoteMessage().payload, "reliable");
+    for (auto i = 6; i < 9; ++i)
+    {
+        EXPECT_EQ(ReadRemoteMessage().payload, std::to_string(i));
+    }
+    EXPECT_EQ(peer->GetSendQueueStatistics().numDroppedMessages, 6u);
+    EXPECT_EQ(peer->GetSendQueueStatistics().queuedMessages, 0u);
+}
+
+TEST_F(VAsioTcpPeerTest, send_queue_error_throws_when_full)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueMaxMessages = 2;
+    config.middleware.sendQueueOverflowPolicy = SilKit::Config::Middleware::SendQueueOverflowPolicy::Error;
+    auto peer = MakeConnectedPeer(config);
+
+    peer->SendSilKitMsg(MakeMessage("0"));
+    peer->SendSilKitMsg(MakeMessage("1"));
+    EXPECT_THROW(peer->SendSilKitMsg(MakeMessage("2")), SilKit::SilKitError);
+
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemoteMessage().payload, "0");
+    EXPECT_EQ(ReadRemoteMessage().payload, "1");
+    EXPECT_EQ(peer->GetWriteStatistics().numWrittenBuffers, 2u);
+}
+
+TEST_F(VAsioTcpPeerTest, send_queue_block_waits_until_drained)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueMaxMessages = 1;
+    auto peer = MakeConnectedPeer(config);
+
+    peer->SendSilKitMsg(MakeMessage("0"));
+    std::thread sender{[this, &peer] {
+        peer->SendSilKitMsg(MakeMessage("1"));
+    }};
+
+    while (peer->GetWriteStatistics().numWrittenBuffers < 2)
+    {
+        _ioContext.run_for(std::chrono::milliseconds{10});
+        _ioContext.restart();
+    }
+    sender.join();
+
+    EXPECT_EQ(ReadRemoteMessage().payload, "0");
+    EXPECT_EQ(ReadRemoteMessage().payload, "1");
+}
+
+TEST_F(VAsioTcpPeerTest, send_queue_high_water_mark_is_notified_when_reached_and_drained)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueMaxMessages = 2;
+    auto peer = MakeConnectedPeer(config);
+
+    std::vector<bool> notifications;
+    _connection->SetSendQueueHighWaterMarkHandler(
+        [&notifications](const SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent& event) {
+            notifications.push_back(event.isAboveHighWaterMark);
+        });
+
+    peer->SendSilKitMsg(MakeMessage("0"));
+    EXPECT_TRUE(notifications.empty());
+    peer->SendSilKitMsg(MakeMessage("1"));
+    EXPECT_EQ(notifications, std::vector<bool>{true});
+
+    _ioContext.run();
+
+    EXPECT_EQ(notifications, (std::vector<bool>{true, false}));
+}
+
+TEST_F(VAsioTcpPeerTest, drain_all_buffers_reports_remaining_messages)
+{
+    auto peer = MakeConnectedPeer({});
+
+    std::size_t queuedBytes{0};
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        queuedBytes += blob.size();
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    // the io context does not run, so nothing is drained
+    const auto drainStatistics = peer->DrainAllBuffers();
+
+    EXPECT_EQ(drainStatistics.numDrainedMessages, 0u);
+    EXPECT_EQ(drainStatistics.numRemainingMessages, 3u);
+    EXPECT_EQ(drainStatistics.numRemainingBytes, queuedBytes);
+}
+
+TEST_F(VAsioTcpPeerTest, peer_statistics_count_sent_and_received_messages)
+{
+    auto peer = MakeConnectedPeer({});
+
+    std::vector<uint8_t> data;
+    for (auto i = 0; i < 3; ++i)
+    {
+        auto blob = MakeMessage(std::to_string(i)).ReleaseStorage();
+        data.insert(data.end(), blob.begin(), blob.end());
+        peer->SendSilKitMsg(SerializedMessage{std::move(blob)});
+    }
+
+    _ioContext.run();
+    _ioContext.restart();
+
+    auto peerStatistics = peer->GetPeerStatistics();
+    EXPECT_EQ(peerStatistics.numSentMessages, 3u);
+    EXPECT_EQ(peerStatistics.numSentBytes, data.size());
+    EXPECT_EQ(peerStatistics.numWrites, 3u);
+    EXPECT_EQ(peerStatistics.maxQueuedMessages, 3u);
+    EXPECT_EQ(peerStatistics.maxQueuedBytes, data.size());
+
+    // the messages are addressed to an unknown receiver and are ignored by the connection
+    peer->StartAsyncRead();
+    WriteRemote(data);
+    RunUntilReceived(peer, 3);
+
+    peerStatistics = peer->GetPeerStatistics();
+    EXPECT_EQ(peerStatistics.numReceivedMessages, 3u);
+    EXPECT_EQ(peerStatistics.numReceivedBytes, data.size());
+}
+
+TEST_F(VAsioTcpPeerTest, compact_headers_are_written_if_supported_by_the_peer)
+{
+    auto peer = MakeConnectedPeer({});
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "RemoteParticipant";
+    peerInfo.capabilities = R"([{"name":"compact-header"}])";
+    peer->SetInfo(peerInfo);
+
+    const auto fullSize = MakeMessage("compact").ReleaseStorage().size();
+    peer->SendSilKitMsg(MakeMessage("compact"));
+    auto sharedStorage = MakeMessage("compact").ReleaseSharedStorage();
+    peer->SendSilKitMsg(SerializedMessage{sharedStorage, 300});
+    // messages other than simulation messages keep their headers
+    peer->SendSilKitMsg(SerializedMessage{VAsioMsgSubscriber{}});
+    _ioContext.run();
+
+    // the remote index 3 and the endpoint id 2 take a single byte each, instead of the endpoint address
+    auto data = ReadRemoteMessageData();
+    EXPECT_EQ(data.size(), fullSize - SerializedMessage::SimMsgHeaderSize + 7);
+    EXPECT_EQ(data[sizeof(uint32_t)], static_cast<uint8_t>(VAsioMsgKind::SilKitSimMsgCompact));
+    SerializedMessage message{std::move(data)};
+    EXPECT_EQ(message.GetMessageKind(), VAsioMsgKind::SilKitSimMsg);
+    EXPECT_EQ(message.GetRemoteIndex(), 3u);
+    EXPECT_EQ(message.GetEndpointAddress().endpoint, 2u);
+    EXPECT_EQ(message.Deserialize<SilKit::Services::Logging::LogMsg>().payload, "compact");
+
+    // the remote index 300 of the shared storage takes two bytes
+    data = ReadRemoteMessageData();
+    EXPECT_EQ(data.size(), fullSize - SerializedMessage::SimMsgHeaderSize + 8);
+    SerializedMessage sharedMessage{std::move(data)};
+    EXPECT_EQ(sharedMessage.GetRemoteIndex(), 300u);
+    EXPECT_EQ(sharedMessage.GetEndpointAddress().endpoint, 2u);
+    EXPECT_EQ(sharedMessage.Deserialize<SilKit::Services::Logging::LogMsg>().payload, "compact");
+
+    SerializedMessage subscriberMessage{ReadRemoteMessageData()};
+    EXPECT_EQ(subscriberMessage.GetMessageKind(), VAsioMsgKind::SubscriptionAnnouncement);
+}
+
+TEST_F(VAsioTcpPeerTest, full_headers_are_written_if_compact_headers_are_not_supported)
+{
+    auto peer = MakeConnectedPeer({});
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "RemoteParticipant";
+    peerInfo.capabilities = R"([{"name":"subscription-batch"}])";
+    peer->SetInfo(peerInfo);
+
+    auto expected = MakeMessage("full").ReleaseStorage();
+    peer->SendSilKitMsg(MakeMessage("full"));
+    _ioContext.run();
+
+    EXPECT_EQ(ReadRemoteMessageData(), expected);
+}
+
+} // anonymous namespace
@@ -22,6 +22,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioConnection.hpp"
 #include "VAsioProtocolVersion.hpp"
 #include "VAsioCapabilities.hpp"
+#include "SharedMemoryChannel.hpp"
 
 #include "SerializedMessage.hpp"
 
@@ -36,6 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 #include "VAsioTcpPeer.hpp"
 #include "VAsioProxyPeer.hpp"
+#include "VAsioLazyPeer.hpp"
 #include "Filesystem.hpp"
 #include "SetThreadName.hpp"
 #include "Uri.hpp"
@@ -214,19 +216,24 @@ auto makeLocalPeerInfo(const std::string& name, SilKit::Core::ParticipantId id,
     return pi;
 }
 
-bool connectWithRetry(SilKit::Core::VAsioTcpPeer* peer, const SilKit::Core::VAsioPeerInfo& pi, size_t connectAttempts)
+bool connectWithRetry(SilKit::Core::VAsioTcpPeer* peer, const SilKit::Core::VAsioPeerInfo& pi, size_t connectAttempts,
+                      std::chrono::steady_clock::duration connectTimeout)
 {
     for (auto i = 0u; i < connectAttempts; i++)
     {
-        try
+        // all URIs are connected concurrently, the handler is called on the strand of the peer
+        auto connected = std::make_shared<std::promise<bool>>();
+        auto isConnected = connected->get_future();
+        peer->ConnectAsync(pi, std::chrono::steady_clock::now() + connectTimeout, [connected](bool ok) {
+            connected->set_value(ok);
+        });
+
+        if (isConnected.get())
         {
-            peer->Connect(pi);
             return true;
         }
-        catch (const std::exception&)
-        {
-            std::this_thread::sleep_for(std::chrono::milliseconds{100});
-        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
     }
     return false;
 }
@@ -275,14 +282,91 @@ auto GetCurrentCapabilities(const SilKit::Config::ParticipantConfiguration& part
         capabilities.AddCapability("proxy-message");
     }
 
+    if (participantConfiguration.middleware.enableSharedMemory && SilKit::Core::SharedMemoryChannel::IsSupported())
+    {
+        capabilities.AddCapability("shared-memory");
+    }
+
+    if (participantConfiguration.middleware.enableLazyPeerConnections
+        && participantConfiguration.middleware.registryAsFallbackProxy)
+    {
+        capabilities.AddCapability("lazy-peer-connections");
+    }
+
+    capabilities.AddCapability("subscription-batch");
+    capabilities.AddCapability("compact-header");
+
     return capabilities.ToCapabilitiesString();
 }
 
+auto GetConnectTimeout(const SilKit::Config::ParticipantConfiguration& participantConfiguration)
+    -> std::chrono::steady_clock::duration
+{
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>{participantConfiguration.middleware.connectTimeoutSeconds});
+}
+
 auto CapabilitiesSupportProxyMessage(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
 {
     return capabilities.HasCapability("proxy-message");
 }
 
+auto CapabilitiesSupportSharedMemory(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
+{
+    return capabilities.HasCapability("shared-memory");
+}
+
+auto CapabilitiesSupportLazyPeerConnections(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
+{
+    return capabilities.HasCapability("lazy-peer-connections");
+}
+
+auto CapabilitiesSupportSubscriptionBatch(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
+{
+    return capabilities.HasCapability("subscription-batch");
+}
+
+auto CapabilitiesIndicateDataConnection(const SilKit::Core::VAsioCapabilities& capabilities) -> bool
+{
+    return capabilities.HasCapability("data-connection");
+}
+
+//! The capabilities announced by a participant whose handshake is relayed through the registry. Empty, if the
+//! payload of the proxy message is not a participant announcement of a supported protocol version.
+auto PeekRelayedAnnouncementCapabilities(const std::vector<uint8_t>& payload) -> SilKit::Core::VAsioCapabilities
+{
+    using namespace SilKit::Core;
+
+    SerializedMessage message{std::vector<uint8_t>{payload}};
+    if (message.GetMessageKind() != VAsioMsgKind::SilKitRegistryMessage
+        || message.GetRegistryKind() != RegistryMessageKind::ParticipantAnnouncement
+        || !ProtocolVersionSupported(message.GetRegistryMessageHeader()))
+    {
+        return VAsioCapabilities{};
+    }
+
+    message.SetProtocolVersion(ExtractProtocolVersion(message.GetRegistryMessageHeader()));
+    return VAsioCapabilities{message.Deserialize<SilKit::Core::ParticipantAnnouncement>().peerInfo.capabilities};
+}
+
+//! The backend asio was built with, see the CMake option SILKIT_ENABLE_IO_URING
+auto GetIoBackendName() -> const char*
+{
+#if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+    return "io_uring";
+#elif defined(ASIO_HAS_IOCP)
+    return "IOCP";
+#elif defined(ASIO_HAS_EPOLL)
+    return "epoll";
+#elif defined(ASIO_HAS_KQUEUE)
+    return "kqueue";
+#elif defined(ASIO_HAS_DEV_POLL)
+    return "/dev/poll";
+#else
+    return "select";
+#endif
+}
+
 } // namespace
 
 namespace std {
@@ -331,6 +415,11 @@ VAsioConnection::VAsioConnection(SilKit::Config::ParticipantConfiguration config
     , _participantName{std::move(participantName)}
     , _participantId{participantId}
     , _timeProvider{timeProvider}
+    , _numIoWorkers{std::max(_config.middleware.ioWorkerThreads, 1)}
+    , _ioContext{_numIoWorkers}
+    , _ioStrand{_ioContext.get_executor()}
+    , _sendQueueMaxBytes{static_cast<std::size_t>(std::max(_config.middleware.sendQueueMaxBytes, 0))}
+    , _sendQueueMaxMessages{static_cast<std::size_t>(std::max(_config.middleware.sendQueueMaxMessages, 0))}
     , _version{version}
 {
     RegisterPeerShutdownCallback([this](IVAsioPeer* peer) { UpdateParticipantStatusOnConnectionLoss(peer); });
@@ -340,20 +429,30 @@ VAsioConnection::VAsioConnection(SilKit::Config::ParticipantConfiguration config
 VAsioConnection::~VAsioConnection()
 {
     _isShuttingDown = true;
+    WakeBlockedSenders();
 
     std::unique_lock<std::mutex> lock{_peersLock};
     decltype(_peers) peers;
     peers.swap(_peers);
     for (auto peer : peers)
     {
-        peer->DrainAllBuffers();
+        const auto drainStatistics = peer->DrainAllBuffers();
+        if (drainStatistics.numDrainedMessages > 0)
+        {
+            Services::Logging::Debug(_logger, "Drained {} messages ({} bytes) to {}",
+                                     drainStatistics.numDrainedMessages, drainStatistics.numDrainedBytes,
+                                     peer->GetInfo().participantName);
+        }
     }
     lock.unlock();
 
-    if (_ioWorker.joinable())
+    _ioContext.stop();
+    for (auto& ioWorker : _ioWorkers)
     {
-        _ioContext.stop();
-        _ioWorker.join();
+        if (ioWorker.joinable())
+        {
+            ioWorker.join();
+        }
     }
 
     // clean up local ipc sockets
@@ -411,7 +510,7 @@ void VAsioConnection::OpenTcpAcceptors(const std::vector<std::string> & acceptor
                     Services::Logging::Debug(_logger, "Accepting {} connections on {}:{}",
                                              (address.is_v4() ? "TCPv4" : "TCPv6"), uri.Host(), uri.Port());
 
-                    _tcpAcceptors.emplace_back(_ioContext);
+                    _tcpAcceptors.emplace_back(_ioStrand);
                     auto& acceptor = _tcpAcceptors.back();
 
                     try
@@ -460,7 +559,7 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string> & accept
             // file must not exist before we bind/listen on it
             (void)fs::remove(endpoint.path());
 
-            _localAcceptors.emplace_back(_ioContext);
+            _localAcceptors.emplace_back(_ioStrand);
             auto& acceptor = _localAcceptors.back();
 
             try
@@ -490,6 +589,9 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
 {
     SILKIT_ASSERT(_logger);
 
+    const auto connectTimeout = GetConnectTimeout(_config);
+    _joinSimulationStart = std::chrono::steady_clock::now();
+
     const auto acceptorEndpointUris = PrepareAcceptorEndpointUris(connectUri);
 
     if (_config.middleware.enableDomainSockets)
@@ -506,7 +608,13 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
         throw SilKitError{"JoinSimulation: no acceptors available"};
     }
 
-    auto registry = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+    LogJoinSimulationStep("Opened acceptors");
+
+    // The connects are completed by the IO workers. Connections may already be accepted from here on: the state
+    // shared with the workers is either fixed at construction (the number of IO workers), or published under a lock.
+    StartIoWorker();
+
+    auto registry = VAsioTcpPeer::Create(asio::make_strand(_ioContext), this, _logger);
     bool ok = false;
 
     // NB: We attempt to connect multiple times. The registry might be a separate process
@@ -517,27 +625,25 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // Compute a list of Registry URIs and attempt to connect as per config
     std::vector<std::string> attemptedUris{{connectUri}};
 
-    _logger->Debug("Connecting to SIL Kit Registry");
+    Services::Logging::Debug(_logger, "Connecting to SIL Kit Registry, using {} for the network IO",
+                             GetIoBackendName());
+
+    VAsioPeerInfo pi;
+    pi.participantName = "SilKitRegistry";
+    pi.participantId = 0;
 
-    // First, attempt local connections if available:
+    // Local connections are preferred, if available, but connected concurrently with TCP
     if (_config.middleware.enableDomainSockets)
     {
         auto localPi = makeLocalPeerInfo("SilKitRegistry", 0, connectUri);
         //store local domain acceptor address for printing debug infos later
         attemptedUris.push_back(localPi.acceptorUris.at(0));
-        ok = connectWithRetry(registry.get(), localPi, connectAttempts);
+        pi.acceptorUris.push_back(localPi.acceptorUris.at(0));
     }
 
-    // Fall back to TCP connections:
-    if (!ok)
-    {
-        // setup TCP remote URI
-        VAsioPeerInfo pi;
-        pi.participantName = "SilKitRegistry";
-        pi.participantId = 0;
-        pi.acceptorUris.push_back(connectUri);
-        ok = connectWithRetry(registry.get(), pi, connectAttempts);
-    }
+    // setup TCP remote URI
+    pi.acceptorUris.push_back(connectUri);
+    ok = connectWithRetry(registry.get(), pi, connectAttempts, connectTimeout);
     // Neither local nor tcp is working.
     if (!ok)
     {
@@ -562,17 +668,26 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
         _logger->Info(ss.str());
     }
 
-    registry->StartAsyncRead();
+    LogJoinSimulationStep("Connected to the registry");
 
-    SendParticipantAnnouncement(registry.get());
-    _registry = std::move(registry);
+    // The registry may be retried for several attempts, the deadline for the other participants starts now
+    _joinSimulationDeadline = std::chrono::steady_clock::now() + connectTimeout;
 
-    StartIoWorker();
+    // The registry must be known before its replies are received. It is published under the lock of the peers,
+    // because GetTrafficStatistics may read it from any thread, e.g., from handlers called by the running IO workers.
+    // The deadline above reaches the connection strand through the replies of the registry.
+    {
+        std::unique_lock<std::mutex> lock{_peersLock};
+        _registry = std::move(registry);
+    }
+    _registry->StartAsyncRead();
+
+    SendParticipantAnnouncement(_registry.get());
 
     auto receivedAllReplies = _receivedAllParticipantReplies.get_future();
     _logger->Debug("SIL Kit is waiting for known participants list from registry.");
 
-    auto waitOk = receivedAllReplies.wait_for(5s);
+    auto waitOk = receivedAllReplies.wait_until(_joinSimulationDeadline);
     if(waitOk == std::future_status::timeout)
     {
         if (_hasReceivedKnownParticipants)
@@ -627,6 +742,8 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // check if an exception was set:
     receivedAllReplies.get();
 
+    LogJoinSimulationStep("Completed the handshakes with all participants");
+
     _logger->Trace("SIL Kit received announcement replies from all participants.");
 }
 
@@ -649,6 +766,14 @@ void VAsioConnection::SendParticipantAnnouncement(IVAsioPeer* peer)
     // URI encoded infos
     VAsioPeerInfo info{_participantName, _participantId, {}, GetCurrentCapabilities(_config)};
 
+    // A data connection announces itself as such, it belongs to a participant which is already known to the remote
+    if (FindDataConnection(peer) != nullptr)
+    {
+        VAsioCapabilities capabilities{info.capabilities};
+        capabilities.AddCapability("data-connection");
+        info.capabilities = capabilities.ToCapabilitiesString();
+    }
+
     size_t openAcceptorCount = 0;
 
     // Ensure that the local acceptors are the first entries in the acceptorUris
@@ -735,6 +860,12 @@ void VAsioConnection::ReceiveParticipantAnnouncement(IVAsioPeer* from, Serialize
     serviceDescriptor.SetParticipantNameAndComputeId(announcement.peerInfo.participantName);
     service.SetServiceDescriptor(serviceDescriptor);
 
+    if (CapabilitiesIndicateDataConnection(VAsioCapabilities{announcement.peerInfo.capabilities}))
+    {
+        AcceptDataConnection(from);
+        return;
+    }
+
     // If one of the handlers for ParticipantAnnouncements throws an exception, report failure to the remote peer
     try
     {
@@ -766,11 +897,15 @@ void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
     // tell the remote peer what *our* protocol version is that we can accept for this peer
     reply.remoteHeader = MakeRegistryMsgHeader(peer->GetProtocolVersion());
     reply.status = ParticipantAnnouncementReply::Status::Success;
-    // fill in the service descriptors we want to subscribe to
-    std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(reply.subscribers),
-                   [](const auto& subscriber) {
-                       return subscriber->GetDescriptor();
-                   });
+    // fill in the service descriptors we want to subscribe to, which a data connection already knows from the
+    // handshake of its participant
+    if (FindDataConnection(peer) == nullptr)
+    {
+        std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(reply.subscribers),
+                       [](const auto& subscriber) {
+                           return subscriber->GetDescriptor();
+                       });
+    }
 
     Services::Logging::Debug(_logger, "Sending ParticipantAnnouncementReply to '{}' with protocol version {}",
                              peer->GetInfo().participantName, ExtractProtocolVersion(reply.remoteHeader));
@@ -819,6 +954,15 @@ void VAsioConnection::ReceiveParticipantAnnouncementReply(IVAsioPeer* from, Seri
             throw error; // for I/O thread
         }
 
+        // the messages of a lazily connected participant are relayed, if its data connection is refused
+        if (auto dataConnection = FindDataConnection(from))
+        {
+            if (auto* lazyPeer = FindLazyPeer(from->GetInfo().participantName))
+            {
+                lazyPeer->OnDataConnectionLost(dataConnection.get());
+            }
+        }
+
         // fail the handshake without tearing down this participant if we are not talking to the registry
         return;
     }
@@ -832,12 +976,33 @@ void VAsioConnection::ReceiveParticipantAnnouncementReply(IVAsioPeer* from, Seri
     Services::Logging::Debug(_logger, "Received participant announcement reply from {} protocol version {}",
                              from->GetInfo().participantName, remoteVersion);
 
+    // Participants on the same host may switch to shared memory, if both of them support it
+    if (_config.middleware.enableSharedMemory && SharedMemoryChannel::IsSupported()
+        && CapabilitiesSupportSharedMemory(VAsioCapabilities{from->GetInfo().capabilities}))
+    {
+        if (auto* tcpPeer = dynamic_cast<VAsioTcpPeer*>(from))
+        {
+            tcpPeer->OfferSharedMemory();
+        }
+    }
+
+    if (auto dataConnection = FindDataConnection(from))
+    {
+        if (auto* lazyPeer = FindLazyPeer(from->GetInfo().participantName))
+        {
+            lazyPeer->OnDataConnectionEstablished(dataConnection);
+        }
+        return;
+    }
+
     auto iter =
         std::find_if(_pendingParticipantReplies.begin(), _pendingParticipantReplies.end(), [&from](const auto& peer) {
             return peer.get() == from;
         });
     if (iter != _pendingParticipantReplies.end())
     {
+        LogJoinSimulationStep(fmt::format("Completed the handshake with {}", from->GetInfo().participantName));
+
         _pendingParticipantReplies.erase(iter);
         if (_pendingParticipantReplies.empty())
         {
@@ -846,6 +1011,130 @@ void VAsioConnection::ReceiveParticipantAnnouncementReply(IVAsioPeer* from, Seri
     }
 }
 
+void VAsioConnection::ConnectPeer(const VAsioPeerInfo& peerInfo)
+{
+    Services::Logging::Debug(_logger, "Connecting to {} with Id {} on {}", peerInfo.participantName,
+                             peerInfo.participantId, printUris(peerInfo));
+
+    if (_config.middleware.enableLazyPeerConnections && _config.middleware.registryAsFallbackProxy
+        && CapabilitiesSupportLazyPeerConnections(VAsioCapabilities{peerInfo.capabilities}))
+    {
+        // The handshake is relayed through the registry, the direct connection is only opened once a service
+        // sends its first message to the other participant
+        auto peer = std::make_shared<VAsioLazyPeer>(this, peerInfo, _registry.get(), _logger);
+        // Remember that we expect a reply from this peer
+        _pendingParticipantReplies.push_back(peer);
+
+        AddConnectedPeer(std::move(peer), peerInfo);
+        return;
+    }
+
+    // Create the "direct-connection" peer
+    auto directPeer = VAsioTcpPeer::Create(asio::make_strand(_ioContext), this, _logger);
+
+    // Remember that we expect a reply from this peer
+    _pendingParticipantReplies.push_back(directPeer);
+
+    // Direct connects are abandoned halfway to the deadline, leaving time for a handshake through the registry
+    const auto connectDeadline = _joinSimulationDeadline - GetConnectTimeout(_config) / 2;
+
+    // Try to connect to the peer only _after_ remembering that we need to connect, otherwise suitable error will be
+    // raised.
+    directPeer->ConnectAsync(peerInfo, connectDeadline, [this, directPeer, peerInfo](bool isConnected) {
+        asio::dispatch(_ioStrand, [this, directPeer, peerInfo, isConnected] {
+            OnPeerConnectCompleted(directPeer, peerInfo, isConnected);
+        });
+    });
+}
+
+void VAsioConnection::OnPeerConnectCompleted(const std::shared_ptr<VAsioTcpPeer>& directPeer,
+                                             const VAsioPeerInfo& peerInfo, bool isConnected)
+{
+    if (isConnected)
+    {
+        LogJoinSimulationStep(fmt::format("Connected to {}", peerInfo.participantName));
+        AddConnectedPeer(directPeer, peerInfo);
+        return;
+    }
+
+    LogJoinSimulationStep(fmt::format("Failed to connect to {}", peerInfo.participantName));
+
+    SilKit::Services::Logging::Warn(
+        _logger,
+        "VAsioConnection: Failed to connect directly to {} on {}, trying to proxy messages through the registry",
+        peerInfo.participantName, printUris(peerInfo));
+
+    if (!_config.middleware.registryAsFallbackProxy)
+    {
+        SilKit::Services::Logging::Warn(_logger,
+                                        "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
+                                        "because it is disabled in the configuration",
+                                        peerInfo.participantName);
+        return;
+    }
+
+    // NB: Cannot check the capabilities of the registry, since we do not receive the PeerInfo from the
+    //       registry over the network, but build it ourselves in VAsioConnection::JoinSimulation.
+    //       This is not be a huge issue, since we can just 'throw the messages at the registry' and will
+    //       fail with the participant-connection-timeout if it is not capable of routing it to the other
+    //       participant.
+
+    // Parse the capabilities reported in the remotes VAsioPeerInfo
+    VAsioCapabilities capabilities{peerInfo.capabilities};
+
+    // To use the ProxyMessage, the peer we're trying to connect to must support it
+    if (!CapabilitiesSupportProxyMessage(capabilities))
+    {
+        SilKit::Services::Logging::Warn(_logger,
+                                        "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
+                                        "because {} does not support it",
+                                        peerInfo.participantName, peerInfo.participantName);
+        return;
+    }
+
+    // Remove the "direct-connection" peer from the list of peers we expect an answer from
+    auto it = std::find(_pendingParticipantReplies.begin(), _pendingParticipantReplies.end(), directPeer);
+    if (it != _pendingParticipantReplies.end())
+    {
+        _pendingParticipantReplies.erase(it);
+    }
+
+    // Create the "proxy-peer" object
+    auto peer = std::make_shared<VAsioProxyPeer>(this, peerInfo, _registry.get(), _logger);
+    // Remember that we expect a reply from this peer
+    _pendingParticipantReplies.push_back(peer);
+
+    AddConnectedPeer(std::move(peer), peerInfo);
+}
+
+void VAsioConnection::AddConnectedPeer(std::shared_ptr<IVAsioConnectionPeer> peer, const VAsioPeerInfo& peerInfo)
+{
+    // We connected to the other peer. tell him who we are.
+    SendParticipantAnnouncement(peer.get());
+
+    // The service ID is incomplete at this stage.
+    ServiceDescriptor peerId;
+    peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
+    peer->SetServiceDescriptor(peerId);
+
+    const auto result =
+        _hashToParticipantName.insert({SilKit::Util::Hash::Hash(peerInfo.participantName), peerInfo.participantName});
+    if (result.second == false)
+    {
+        SILKIT_ASSERT(false);
+    }
+
+    AssociateParticipantNameAndPeer(peer->GetInfo().participantName, peer.get());
+    AddPeer(std::move(peer));
+}
+
+void VAsioConnection::LogJoinSimulationStep(const std::string& step)
+{
+    const auto elapsed = std::chrono::steady_clock::now() - _joinSimulationStart;
+    Services::Logging::Debug(_logger, "JoinSimulation: {} after {} ms", step,
+                             std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+}
+
 void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessage&& buffer)
 {
     auto participantsMsg = buffer.Deserialize<KnownParticipants>();
@@ -873,125 +1162,169 @@ void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessag
     Services::Logging::Debug(_logger, "Received known participants list from SilKitRegistry protocol {}.{}",
                              participantsMsg.messageHeader.versionHigh, participantsMsg.messageHeader.versionLow);
 
-    auto connectPeer = [this](const VAsioPeerInfo peerInfo) {
-        Services::Logging::Debug(_logger, "Connecting to {} with Id {} on {}", peerInfo.participantName,
-                                 peerInfo.participantId, printUris(peerInfo));
+    LogJoinSimulationStep(fmt::format("Received {} known participants", participantsMsg.peerInfos.size()));
 
-        // Create the "direct-connection" peer
-        auto directPeer = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+    // All participants are connected concurrently, the handshakes continue once the connections are established
+    for (auto&& peerInfo : participantsMsg.peerInfos)
+    {
+        ConnectPeer(peerInfo);
+    }
 
-        // Remember that we expect a reply from this peer
-        _pendingParticipantReplies.push_back(directPeer);
+    if (_pendingParticipantReplies.empty())
+    {
+        _receivedAllParticipantReplies.set_value();
+    }
+    Services::Logging::Trace(_logger, "SIL Kit is waiting for {} ParticipantAnnouncementReplies",
+                             _pendingParticipantReplies.size());
+}
 
-        std::shared_ptr<IVAsioConnectionPeer> peer;
 
-        // Try to connect to the peer only _after_ remembering that we need to connect, otherwise suitable error will
-        // be raised.
-        try
-        {
-            directPeer->Connect(peerInfo);
-            peer = std::move(directPeer);
-        }
-        catch (const std::exception& exception)
-        {
-            SilKit::Services::Logging::Warn(
-                _logger,
-                "VAsioConnection: Failed to connect directly to {}, trying to proxy messages through the registry: {}",
-                peerInfo.participantName, exception.what());
 
-            if (!_config.middleware.registryAsFallbackProxy)
-            {
-                SilKit::Services::Logging::Warn(_logger,
-                                                "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
-                                                "because it is disabled in the configuration",
-                                                peerInfo.participantName);
-                return;
-            }
+void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& participantName, IVAsioPeer* peer)
+{
+    _participantNameToPeer.insert({participantName, peer});
+}
 
-            // NB: Cannot check the capabilities of the registry, since we do not receive the PeerInfo from the
-            //       registry over the network, but build it ourselves in VAsioConnection::JoinSimulation.
-            //       This is not be a huge issue, since we can just 'throw the messages at the registry' and will
-            //       fail with the participant-connection-timeout if it is not capable of routing it to the other
-            //       participant.
+auto VAsioConnection::CreateDataConnection(VAsioLazyPeer* lazyPeer) -> std::shared_ptr<VAsioTcpPeer>
+{
+    if (!CapabilitiesSupportLazyPeerConnections(VAsioCapabilities{lazyPeer->GetInfo().capabilities}))
+    {
+        return nullptr;
+    }
 
-            // Parse the capabilities reported in the remotes VAsioPeerInfo
-            VAsioCapabilities capabilities{peerInfo.capabilities};
+    return VAsioTcpPeer::Create(asio::make_strand(_ioContext), this, _logger);
+}
 
-            // To use the ProxyMessage, the peer we're trying to connect to must support it
-            if (!CapabilitiesSupportProxyMessage(capabilities))
-            {
-                SilKit::Services::Logging::Warn(_logger,
-                                                "VAsioConnection: Cannot use ProxyMessage to communicate with {}, "
-                                                "because {} does not support it",
-                                                peerInfo.participantName, peerInfo.participantName);
-                return;
-            }
+void VAsioConnection::ConnectDataConnection(VAsioLazyPeer* lazyPeer, std::shared_ptr<VAsioTcpPeer> dataConnection)
+{
+    // The first message of a service must not wait for the resolution of the URIs and the connects, neither must
+    // the other peers served by the IO strand
+    const auto connectDeadline = std::chrono::steady_clock::now() + GetConnectTimeout(_config);
+    dataConnection->ConnectAsync(lazyPeer->GetInfo(), connectDeadline, [this, dataConnection](bool isConnected) {
+        asio::dispatch(_ioStrand, [this, dataConnection, isConnected] {
+            OnDataConnectionConnectCompleted(dataConnection, isConnected);
+        });
+    });
+}
 
-            // Remove the "direct-connection" peer from the list of peers we expect an answer from
-            auto it = std::find(_pendingParticipantReplies.begin(), _pendingParticipantReplies.end(), directPeer);
-            _pendingParticipantReplies.erase(it);
-            // Destroy the peer object
-            directPeer = nullptr;
+void VAsioConnection::OnDataConnectionConnectCompleted(const std::shared_ptr<VAsioTcpPeer>& dataConnection,
+                                                       bool isConnected)
+{
+    const auto& peerInfo = dataConnection->GetInfo();
 
-            // Create the "proxy-peer" object
-            peer = std::make_shared<VAsioProxyPeer>(this, peerInfo, _registry.get(), _logger);
-            // Remember that we expect a reply from this peer
-            _pendingParticipantReplies.push_back(peer);
-        }
+    auto* const lazyPeer = FindLazyPeer(peerInfo.participantName);
+    if (lazyPeer == nullptr || _isShuttingDown)
+    {
+        return;
+    }
+
+    if (!isConnected)
+    {
+        SilKit::Services::Logging::Warn(_logger,
+                                        "VAsioConnection: Failed to open a data connection to {} on {}, its "
+                                        "messages are relayed through the registry",
+                                        peerInfo.participantName, printUris(peerInfo));
+        lazyPeer->OnDataConnectionLost(dataConnection.get());
+        return;
+    }
 
-        // We connected to the other peer. tell him who we are.
-        SendParticipantAnnouncement(peer.get());
+    ServiceDescriptor peerId;
+    peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
+    dataConnection->SetServiceDescriptor(peerId);
 
-        // The service ID is incomplete at this stage.
-        ServiceDescriptor peerId;
-        peerId.SetParticipantNameAndComputeId(peerInfo.participantName);
-        peer->SetServiceDescriptor(peerId);
+    {
+        std::unique_lock<decltype(_dataConnectionsMutex)> lock{_dataConnectionsMutex};
+        _dataConnections.push_back(dataConnection);
+    }
 
-        const auto result =
-            _hashToParticipantName.insert({SilKit::Util::Hash::Hash(peerInfo.participantName), peerInfo.participantName});
-        if (result.second == false)
-        {
-            SILKIT_ASSERT(false);
-        }
+    Services::Logging::Debug(_logger, "Opened data connection to {}", peerInfo.participantName);
 
-        AssociateParticipantNameAndPeer(peer->GetInfo().participantName, peer.get());
-        AddPeer(std::move(peer));
-    };
-    // check URI first
-    for (auto&& peerInfo : participantsMsg.peerInfos)
+    // The lazy peer sends its messages via the data connection, once the announcement is replied
+    dataConnection->StartAsyncRead();
+    SendParticipantAnnouncement(dataConnection.get());
+}
+
+void VAsioConnection::AcceptDataConnection(IVAsioPeer* from)
+{
+    auto* const lazyPeer = FindLazyPeer(from->GetInfo().participantName);
+    if (lazyPeer == nullptr)
     {
-        connectPeer(peerInfo);
+        SendFailedParticipantAnnouncementReply(from, from->GetProtocolVersion(),
+                                               "data connection of a participant which is not connected lazily");
+        return;
     }
 
-    if (_pendingParticipantReplies.empty())
+    // The data connection does not represent a participant of its own
+    std::shared_ptr<IVAsioPeer> dataConnection;
     {
-        _receivedAllParticipantReplies.set_value();
+        std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+        auto it = std::find_if(_peers.begin(), _peers.end(), [from](const auto& peer) {
+            return peer.get() == from;
+        });
+        if (it == _peers.end())
+        {
+            return;
+        }
+        dataConnection = std::move(*it);
+        _peers.erase(it);
     }
-    Services::Logging::Trace(_logger, "SIL Kit is waiting for {} ParticipantAnnouncementReplies",
-                             _pendingParticipantReplies.size());
+    {
+        std::unique_lock<decltype(_dataConnectionsMutex)> lock{_dataConnectionsMutex};
+        _dataConnections.push_back(dataConnection);
+    }
+
+    Services::Logging::Debug(_logger, "Accepted data connection from {}", from->GetInfo().participantName);
+
+    SendParticipantAnnouncementReply(from);
+    lazyPeer->OnDataConnectionEstablished(dataConnection);
 }
 
+auto VAsioConnection::FindDataConnection(IVAsioPeer* peer) -> std::shared_ptr<IVAsioPeer>
+{
+    std::unique_lock<decltype(_dataConnectionsMutex)> lock{_dataConnectionsMutex};
+    auto it = std::find_if(_dataConnections.begin(), _dataConnections.end(), [peer](const auto& dataConnection) {
+        return dataConnection.get() == peer;
+    });
+    return it == _dataConnections.end() ? nullptr : *it;
+}
 
+auto VAsioConnection::FindLazyPeer(const std::string& participantName) -> VAsioLazyPeer*
+{
+    auto it = _participantNameToPeer.find(participantName);
+    return it == _participantNameToPeer.end() ? nullptr : dynamic_cast<VAsioLazyPeer*>(it->second);
+}
 
-void VAsioConnection::AssociateParticipantNameAndPeer(const std::string& participantName, IVAsioPeer* peer)
+void VAsioConnection::PublishVAsioReceivers()
 {
-    _participantNameToPeer.insert({participantName, peer});
+    auto receivers = std::make_unique<std::vector<IVAsioReceiver*>>();
+    receivers->reserve(_vasioReceivers.size());
+    for (const auto& receiver : _vasioReceivers)
+    {
+        receivers->push_back(receiver.get());
+    }
+
+    // The IO worker threads may still read the previous table, it is only released with the connection
+    _vasioReceiverTable.store(receivers.get(), std::memory_order_release);
+    _vasioReceiverTables.emplace_back(std::move(receivers));
 }
 void VAsioConnection::StartIoWorker()
 {
-    _ioWorker = std::thread{[this]() {
-        try
-        {
-            SilKit::Util::SetThreadName("SilKit-IOWorker");
-            _ioContext.run();
-            return 0;
-        }
-        catch (const std::exception& error)
-        {
-            Services::Logging::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
-            return -1;
-        }
-    }};
+    for (auto i = 0; i < _numIoWorkers; ++i)
+    {
+        _ioWorkers.emplace_back([this]() {
+            try
+            {
+                SilKit::Util::SetThreadName("SilKit-IOWorker");
+                _ioContext.run();
+                return 0;
+            }
+            catch (const std::exception& error)
+            {
+                Services::Logging::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
+                return -1;
+            }
+        });
+    }
 }
 
 void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
@@ -1001,7 +1334,7 @@ void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
     // file must not exist before we bind/listen on it
     (void)fs::remove(localEndpoint.path());
 
-    _localAcceptors.emplace_back(_ioContext);
+    _localAcceptors.emplace_back(_ioStrand);
     auto &acceptor = _localAcceptors.back();
 
     AcceptConnectionsOn(acceptor, localEndpoint);
@@ -1036,7 +1369,7 @@ auto VAsioConnection::AcceptTcpConnectionsOn(const std::string& hostName, uint16
                        (isIpv4(endpoint) ? "TCPv4" : "TCPv6"));
     }
 
-    _tcpAcceptors.emplace_back(_ioContext);
+    _tcpAcceptors.emplace_back(_ioStrand);
     auto &acceptor = _tcpAcceptors.back();
 
     const auto localEndpoint = AcceptConnectionsOn(acceptor, endpoint);
@@ -1066,7 +1399,7 @@ auto VAsioConnection::AcceptConnectionsOn(AcceptorT& acceptor, EndpointT endpoin
     catch (const std::exception& e)
     {
         Services::Logging::Error(_logger, "SIL Kit failed to listening on {}: {}", endpoint, e.what());
-        acceptor = AcceptorT{_ioContext}; // Reset socket
+        acceptor = AcceptorT{_ioStrand}; // Reset socket
         throw;
     }
 
@@ -1083,7 +1416,7 @@ void VAsioConnection::AcceptNextConnection(AcceptorT& acceptor)
     std::shared_ptr<VAsioTcpPeer> newConnection;
     try
     {
-        newConnection = VAsioTcpPeer::Create(_ioContext.get_executor(), this, _logger);
+        newConnection = VAsioTcpPeer::Create(asio::make_strand(_ioContext), this, _logger);
     }
     catch (const std::exception& e)
     {
@@ -1119,6 +1452,40 @@ void VAsioConnection::AddPeer(std::shared_ptr<IVAsioPeer> newPeer)
     _peers.emplace_back(std::move(newPeer));
 }
 
+void VAsioConnection::StartSendBuffering()
+{
+    if (!_config.middleware.enableMessageCoalescing)
+    {
+        return;
+    }
+
+    // Posted like the messages of SendMsg, so that the peers hold back exactly the messages sent in between
+    ExecuteOnIoThreadPooled([this] {
+        _isBufferingSends = true;
+    });
+}
+
+void VAsioConnection::FlushSendBuffers()
+{
+    if (!_config.middleware.enableMessageCoalescing)
+    {
+        return;
+    }
+
+    ExecuteOnIoThreadPooled([this] {
+        if (!_isBufferingSends.exchange(false))
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock{_peersLock};
+        for (auto&& peer : _peers)
+        {
+            peer->FlushSendBuffers();
+        }
+    });
+}
+
 void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer* peer)> callback)
 {
     ExecuteOnIoThread([this, callback{std::move(callback)}]{
@@ -1128,8 +1495,29 @@ void VAsioConnection::RegisterPeerShutdownCallback(std::function<void(IVAsioPeer
 
 void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 {
+    if (IsOffConnectionStrand())
+    {
+        asio::post(_ioStrand, [this, peer]() { OnPeerShutdown(peer); });
+        return;
+    }
+
     if (!_isShuttingDown)
     {
+        // A closed data connection only affects the participant's VAsioLazyPeer, which relays its messages again
+        if (auto dataConnection = FindDataConnection(peer))
+        {
+            {
+                std::unique_lock<decltype(_dataConnectionsMutex)> lock{_dataConnectionsMutex};
+                _dataConnections.erase(std::find(_dataConnections.begin(), _dataConnections.end(), dataConnection));
+            }
+
+            if (auto* lazyPeer = FindLazyPeer(peer->GetInfo().participantName))
+            {
+                lazyPeer->OnDataConnectionLost(peer);
+            }
+            return;
+        }
+
         std::vector<IVAsioPeer*> proxyPeers;
 
         {
@@ -1161,6 +1549,8 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
             RemovePeerFromLinks(peer);
             RemovePeerFromConnection(peer);
         }
+
+        _pendingSubscriptionAnnouncements.erase(peer);
     }
 }
 
@@ -1259,6 +1649,20 @@ void VAsioConnection::UpdateParticipantStatusOnConnectionLoss(IVAsioPeer* peer)
 void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto messageKind = buffer.GetMessageKind();
+    if (IsOffConnectionStrand())
+    {
+        if (IsMwOrSim(messageKind))
+        {
+            // deserialized on the peer's strand, distributed on the connection's strand
+            return ReceiveRawSilKitMessage(from, std::move(buffer));
+        }
+
+        ExecuteOnIoThreadPooled([this, from, buffer = std::move(buffer)]() mutable {
+            OnSocketData(from, std::move(buffer));
+        });
+        return;
+    }
+
     switch (messageKind)
     {
     case VAsioMsgKind::Invalid:
@@ -1268,9 +1672,14 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveSubscriptionAnnouncement(from, std::move(buffer));
     case VAsioMsgKind::SubscriptionAcknowledge:
         return ReceiveSubscriptionAcknowledge(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionAnnouncementBatch:
+        return ReceiveSubscriptionAnnouncementBatch(from, std::move(buffer));
+    case VAsioMsgKind::SubscriptionAcknowledgeBatch:
+        return ReceiveSubscriptionAcknowledgeBatch(from, std::move(buffer));
     case VAsioMsgKind::SilKitMwMsg:
         return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitSimMsg:
+    case VAsioMsgKind::SilKitSimMsgCompact: // already read as SilKitSimMsg
         return ReceiveRawSilKitMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitRegistryMessage:
         return ReceiveRegistryMessage(from, std::move(buffer));
@@ -1292,7 +1701,8 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         return;
     }
 
-    auto proxyMessage = buffer.Deserialize<ProxyMessage>();
+    // Only the routing information is deserialized, the payload is opaque to the proxy
+    const auto proxyRouting = buffer.PeekProxyMessageRouting();
 
     if (!_config.middleware.registryAsFallbackProxy)
     {
@@ -1300,47 +1710,61 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         SilKit::Services::Logging::Warn(
             _logger, onceFlag,
             "Ignoring VAsioMsgKind::SilKitProxyMessage because feature is disabled via configuration: From {}, To {}",
-            proxyMessage.source, proxyMessage.destination);
+            proxyRouting.source, proxyRouting.destination);
         return;
     }
 
     SilKit::Services::Logging::Trace(_logger,
                                      "Received message with VAsioMsgKind::SilKitProxyMessage: From {}, To {}",
-                                     proxyMessage.source, proxyMessage.destination);
+                                     proxyRouting.source, proxyRouting.destination);
 
-    const bool fromIsSource = from->GetInfo().participantName == proxyMessage.source;
+    const bool fromIsSource = from->GetInfo().participantName == proxyRouting.source;
     if (fromIsSource)
     {
-        auto it = _participantNameToPeer.find(proxyMessage.destination);
+        auto it = _participantNameToPeer.find(proxyRouting.destination);
         if (it == _participantNameToPeer.end())
         {
             SilKit::Services::Logging::Error(_logger, "Unable to deliver proxy message from {} to {}",
-                                             proxyMessage.source, proxyMessage.destination);
+                                             proxyRouting.source, proxyRouting.destination);
             return;
         }
 
-        it->second->SendSilKitMsg(SerializedMessage{proxyMessage});
+        // The received message is forwarded as-is, its bytes are neither deserialized nor copied
+        it->second->SendSilKitMsg(std::move(buffer));
 
         // We are relaying a message from source to destination and acting as a proxy. Record the association between
         // source and destination. This is used during disconnects, where we create empty ProxyMessages on behalf of
         // the disconnected peer, to inform the destination that the source peer has disconnected.
-        _proxySourceToDestinations[proxyMessage.source].insert(proxyMessage.destination);
+        _proxySourceToDestinations[proxyRouting.source].insert(proxyRouting.destination);
 
         return;
     }
 
-    const bool isDestination = GetParticipantName() == proxyMessage.destination;
+    const bool isDestination = GetParticipantName() == proxyRouting.destination;
     if (isDestination)
     {
-        auto it = _participantNameToPeer.find(proxyMessage.source);
+        auto it = _participantNameToPeer.find(proxyRouting.source);
 
         IVAsioPeer* peer{nullptr};
 
+        auto payload = buffer.ReleaseProxyMessagePayload();
+
         if (it == _participantNameToPeer.end())
         {
-            SilKit::Services::Logging::Debug(_logger, "Creating VAsioProxyPeer ({})", proxyMessage.source);
+            SilKit::Services::Logging::Debug(_logger, "Creating VAsioProxyPeer ({})", proxyRouting.source);
 
-            auto proxyPeer = std::make_shared<VAsioProxyPeer>(this, VAsioPeerInfo{}, from, _logger);
+            // The first message of the source is its relayed announcement. Only a source advertising lazy peer
+            // connections accepts the data connection opened by a VAsioLazyPeer.
+            std::shared_ptr<VAsioProxyPeer> proxyPeer;
+            if (_config.middleware.enableLazyPeerConnections && !payload.empty()
+                && CapabilitiesSupportLazyPeerConnections(PeekRelayedAnnouncementCapabilities(payload)))
+            {
+                proxyPeer = std::make_shared<VAsioLazyPeer>(this, VAsioPeerInfo{}, from, _logger);
+            }
+            else
+            {
+                proxyPeer = std::make_shared<VAsioProxyPeer>(this, VAsioPeerInfo{}, from, _logger);
+            }
             AddPeer(proxyPeer);
 
             peer = proxyPeer.get();
@@ -1351,13 +1775,17 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
         }
 
         // An empty payload signals shutdown of the proxied peer.
-        if (proxyMessage.payload.empty())
+        if (payload.empty())
         {
             OnPeerShutdown(peer);
         }
         else
         {
-            OnSocketData(peer, SerializedMessage{std::move(proxyMessage.payload)});
+            if (auto* const proxyPeer = dynamic_cast<VAsioProxyPeer*>(peer))
+            {
+                proxyPeer->CountReceivedMessage(payload.size());
+            }
+            OnSocketData(peer, SerializedMessage{std::move(payload)});
         }
 
         return;
@@ -1365,6 +1793,32 @@ void VAsioConnection::ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&&
 }
 
 void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
+    auto ack = AcknowledgeSubscription(from, std::move(subscriber));
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+}
+
+void VAsioConnection::ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAnnouncementBatch>();
+
+    Services::Logging::Debug(_logger, "Received {} subscriptions from {}", batch.subscribers.size(),
+                             from->GetInfo().participantName);
+
+    SubscriptionAcknowledgeBatch acks;
+    acks.acknowledges.reserve(batch.subscribers.size());
+    for (auto&& subscriber : batch.subscribers)
+    {
+        acks.acknowledges.emplace_back(AcknowledgeSubscription(from, std::move(subscriber)));
+    }
+
+    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), acks});
+}
+
+auto VAsioConnection::AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber)
+    -> SubscriptionAcknowledge
 {
     // Note: there may be multiple types that match the SerdesName
     // we try to find a version to match it, for backward compatibility.
@@ -1386,8 +1840,9 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         return subscriptionVersion;
     };
 
-    auto subscriber = buffer.Deserialize<VAsioMsgSubscriber>();
-    bool wasAdded = TryAddRemoteSubscriber(from, subscriber);
+    // The messages for the subscribers of a lazily connected participant are sent to its VAsioLazyPeer, which knows
+    // them from the relayed subscriptions. An accepted data connection is not known as such before its announcement.
+    bool wasAdded = FindDataConnection(from) != nullptr || TryAddRemoteSubscriber(from, subscriber);
 
     // check our Message version against the remote participant's version
     auto myMessageVersion = getVersionForSerdes(subscriber.msgTypeName, subscriber.version);
@@ -1403,14 +1858,13 @@ void VAsioConnection::ReceiveSubscriptionAnnouncement(IVAsioPeer* from, Serializ
         // Tell our peer what version of the given message type we have
         subscriber.version = myMessageVersion;
     }
-    // send acknowledge
     SubscriptionAcknowledge ack;
     ack.subscriber = std::move(subscriber);
     ack.status = wasAdded
         ? SubscriptionAcknowledge::Status::Success
         : SubscriptionAcknowledge::Status::Failed;
 
-    from->SendSilKitMsg(SerializedMessage{from->GetProtocolVersion(), ack});
+    return ack;
 }
 
 void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer)
@@ -1429,6 +1883,22 @@ void VAsioConnection::ReceiveSubscriptionAcknowledge(IVAsioPeer* from, Serialize
     RemovePendingSubscription({from, ack.subscriber});
 }
 
+void VAsioConnection::ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer)
+{
+    auto batch = buffer.Deserialize<SubscriptionAcknowledgeBatch>();
+
+    for (const auto& ack : batch.acknowledges)
+    {
+        if (ack.status != SubscriptionAcknowledge::Status::Success)
+        {
+            Services::Logging::Error(_logger, "Failed to subscribe [{}] {} from {}", ack.subscriber.networkName,
+                                     ack.subscriber.msgTypeName, from->GetInfo().participantName);
+        }
+    }
+
+    RemovePendingSubscriptions(from, batch.acknowledges);
+}
+
 void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ackId)
 {
     auto iterPendingSync =
@@ -1436,7 +1906,7 @@ void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ack
     if (iterPendingSync != _pendingSubscriptionAcknowledges.end())
     {
         _pendingSubscriptionAcknowledges.erase(iterPendingSync);
-        if (_pendingSubscriptionAcknowledges.empty())
+        if (_pendingSubscriptionAcknowledges.empty() && !_isRegisteringServiceBatch)
         {
             SyncSubscriptionsCompleted();
         }
@@ -1454,6 +1924,272 @@ void VAsioConnection::RemovePendingSubscription(const PendingAcksIdentifier& ack
     }
 }
 
+void VAsioConnection::RemovePendingSubscriptions(IVAsioPeer* from, const std::vector<SubscriptionAcknowledge>& acks)
+{
+    // The receiver index identifies the subscription of the peer, the whole batch is removed in a single pass
+    std::unordered_map<EndpointId, const VAsioMsgSubscriber*> acknowledgedSubscribers;
+    for (const auto& ack : acks)
+    {
+        acknowledgedSubscribers[ack.subscriber.receiverIdx] = &ack.subscriber;
+    }
+
+    const auto isAcknowledged = [from, &acknowledgedSubscribers](const PendingAcksIdentifier& ackId) {
+        if (ackId.first != from)
+        {
+            return false;
+        }
+        const auto it = acknowledgedSubscribers.find(ackId.second.receiverIdx);
+        return it != acknowledgedSubscribers.end() && *it->second == ackId.second;
+    };
+
+    if (!_pendingSubscriptionAcknowledges.empty())
+    {
+        _pendingSubscriptionAcknowledges.erase(std::remove_if(_pendingSubscriptionAcknowledges.begin(),
+                                                              _pendingSubscriptionAcknowledges.end(), isAcknowledged),
+                                               _pendingSubscriptionAcknowledges.end());
+        if (_pendingSubscriptionAcknowledges.empty() && !_isRegisteringServiceBatch)
+        {
+            SyncSubscriptionsCompleted();
+        }
+    }
+
+    if (!_pendingAsyncSubscriptionAcknowledges.empty())
+    {
+        _pendingAsyncSubscriptionAcknowledges.erase(
+            std::remove_if(_pendingAsyncSubscriptionAcknowledges.begin(), _pendingAsyncSubscriptionAcknowledges.end(),
+                           isAcknowledged),
+            _pendingAsyncSubscriptionAcknowledges.end());
+        if (_pendingAsyncSubscriptionAcknowledges.empty())
+        {
+            AsyncSubscriptionsCompleted();
+        }
+    }
+}
+
+void VAsioConnection::FlushSubscriptionAnnouncements()
+{
+    for (auto&& peerAndSubscribers : _pendingSubscriptionAnnouncements)
+    {
+        auto* peer = peerAndSubscribers.first;
+        auto& subscribers = peerAndSubscribers.second;
+
+        if (subscribers.size() > 1
+            && CapabilitiesSupportSubscriptionBatch(VAsioCapabilities{peer->GetInfo().capabilities}))
+        {
+            Services::Logging::Debug(_logger, "Announcing {} subscriptions to {}", subscribers.size(),
+                                     peer->GetInfo().participantName);
+
+            SubscriptionAnnouncementBatch batch;
+            batch.subscribers = std::move(subscribers);
+            peer->SendSilKitMsg(SerializedMessage{batch});
+            continue;
+        }
+
+        for (auto&& subscriber : subscribers)
+        {
+            peer->Subscribe(std::move(subscriber));
+        }
+    }
+
+    _pendingSubscriptionAnnouncements.clear();
+}
+
+void VAsioConnection::BeginServiceRegistrationBatch()
+{
+    if (_isBatchingServiceRegistrations)
+    {
+        throw SilKitError{"BeginServiceRegistrationBatch: a service registration batch was already begun"};
+    }
+
+    SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
+    _receivedAllSubscriptionAcknowledges = std::promise<void>{};
+    _isBatchingServiceRegistrations = true;
+
+    asio::post(_ioStrand, [this] {
+        _isRegisteringServiceBatch = true;
+    });
+}
+
+void VAsioConnection::EndServiceRegistrationBatch()
+{
+    if (!_isBatchingServiceRegistrations)
+    {
+        throw SilKitError{"EndServiceRegistrationBatch: no service registration batch was begun"};
+    }
+
+    _isBatchingServiceRegistrations = false;
+    auto allAcked = _receivedAllSubscriptionAcknowledges.get_future();
+
+    asio::post(_ioStrand, [this] {
+        _isRegisteringServiceBatch = false;
+
+        FlushSubscriptionAnnouncements();
+
+        if (_pendingSubscriptionAcknowledges.empty())
+        {
+            SyncSubscriptionsCompleted();
+        }
+        if (_pendingAsyncSubscriptionAcknowledges.empty())
+        {
+            AsyncSubscriptionsCompleted();
+        }
+    });
+
+    _logger->Trace("SIL Kit waiting for subscription acknowledges of the service registration batch.");
+    allAcked.wait();
+    _logger->Trace("SIL Kit received all subscription acknowledges of the service registration batch.");
+}
+
+void VAsioConnection::SetSendQueueHighWaterMarkHandler(
+    SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler)
+{
+    std::unique_lock<std::mutex> lock{_sendQueueHighWaterMarkHandlerMutex};
+    _sendQueueHighWaterMarkHandler = std::move(handler);
+}
+
+void VAsioConnection::OnSendQueueHighWaterMark(
+    const SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent& event)
+{
+    if (event.isAboveHighWaterMark)
+    {
+        Services::Logging::Warn(_logger, "The sending queue to {} is full: {} messages ({} bytes) queued",
+                                event.participantName, event.queuedMessages, event.queuedBytes);
+    }
+    else
+    {
+        Services::Logging::Info(_logger, "The sending queue to {} drained: {} messages ({} bytes) queued, {} dropped",
+                                event.participantName, event.queuedMessages, event.queuedBytes,
+                                event.numDroppedMessages);
+    }
+
+    if (event.isAboveHighWaterMark)
+    {
+        _numFullSendQueues.fetch_add(1);
+    }
+    else
+    {
+        _numFullSendQueues.fetch_sub(1);
+        WakeBlockedSenders();
+    }
+
+    std::unique_lock<std::mutex> lock{_sendQueueHighWaterMarkHandlerMutex};
+    if (_sendQueueHighWaterMarkHandler)
+    {
+        _sendQueueHighWaterMarkHandler(event);
+    }
+}
+
+bool VAsioConnection::HasBlockingSendQueueLimits() const
+{
+    return (_sendQueueMaxBytes > 0 || _sendQueueMaxMessages > 0)
+           && _config.middleware.sendQueueOverflowPolicy != Config::Middleware::SendQueueOverflowPolicy::DropOldest;
+}
+
+bool VAsioConnection::IsSendQueueFull() const
+{
+    // The messages waiting for the strand are not yet queued by any peer, they are limited as if they were
+    return _numFullSendQueues > 0 || (_sendQueueMaxMessages > 0 && _numPendingSendMessages >= _sendQueueMaxMessages);
+}
+
+void VAsioConnection::HandleSendQueueOverflow()
+{
+    if (_config.middleware.sendQueueOverflowPolicy == Config::Middleware::SendQueueOverflowPolicy::Error)
+    {
+        throw SilKitError{fmt::format("The sending queues of participant '{}' are full: {} peer queue(s) at their "
+                                      "limits, {} messages waiting to be queued",
+                                      _participantName, _numFullSendQueues.load(), _numPendingSendMessages.load())};
+    }
+
+    std::unique_lock<std::mutex> lock{_sendQueueSpaceMutex};
+    ++_numBlockedSenders;
+    _sendQueueSpaceAvailable.wait(lock, [this] {
+        return !IsSendQueueFull() || _isShuttingDown;
+    });
+    --_numBlockedSenders;
+}
+
+void VAsioConnection::ReleaseSendQueueSpace(const PendingSend& pendingSend)
+{
+    if (!pendingSend.isCounted)
+    {
+        return;
+    }
+
+    _numPendingSendMessages.fetch_sub(1);
+    if (_numBlockedSenders > 0)
+    {
+        WakeBlockedSenders();
+    }
+}
+
+void VAsioConnection::WakeBlockedSenders()
+{
+    // Locking the mutex ensures that a sender which just found the queues full is already waiting
+    {
+        std::lock_guard<std::mutex> lock{_sendQueueSpaceMutex};
+    }
+    _sendQueueSpaceAvailable.notify_all();
+}
+
+auto VAsioConnection::GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics
+{
+    SilKit::Experimental::Participant::TrafficStatistics trafficStatistics;
+
+    auto addPeer = [&trafficStatistics](const IVAsioPeer& peer) {
+        const auto peerStatistics = peer.GetPeerStatistics();
+
+        SilKit::Experimental::Participant::PeerTrafficStatistics peerTrafficStatistics;
+        peerTrafficStatistics.participantName = peer.GetInfo().participantName;
+        peerTrafficStatistics.numSentMessages = peerStatistics.numSentMessages;
+        peerTrafficStatistics.numSentBytes = peerStatistics.numSentBytes;
+        peerTrafficStatistics.numWrites = peerStatistics.numWrites;
+        peerTrafficStatistics.maxQueuedMessages = peerStatistics.maxQueuedMessages;
+        peerTrafficStatistics.maxQueuedBytes = peerStatistics.maxQueuedBytes;
+        peerTrafficStatistics.numReceivedMessages = peerStatistics.numReceivedMessages;
+        peerTrafficStatistics.numReceivedBytes = peerStatistics.numReceivedBytes;
+        trafficStatistics.peers.push_back(std::move(peerTrafficStatistics));
+    };
+
+    {
+        std::unique_lock<std::mutex> lock{_peersLock};
+        if (_registry)
+        {
+            addPeer(*_registry);
+        }
+        for (auto&& peer : _peers)
+        {
+            addPeer(*peer);
+        }
+    }
+
+    tt::for_each(_links, [this, &trafficStatistics](auto&& linkMap) {
+        using LinkPtr = typename std::decay_t<decltype(linkMap)>::mapped_type;
+        using LinkType = typename LinkPtr::element_type;
+
+        // access the links under lock
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+        for (auto&& networkNameAndLink : linkMap)
+        {
+            // looking up the remote receivers of a network inserts empty entries
+            if (!networkNameAndLink.second)
+            {
+                continue;
+            }
+
+            const auto linkStatistics = networkNameAndLink.second->GetStatistics();
+
+            SilKit::Experimental::Participant::LinkTrafficStatistics linkTrafficStatistics;
+            linkTrafficStatistics.networkName = networkNameAndLink.first;
+            linkTrafficStatistics.messageTypeName = LinkType::MsgTypeName();
+            linkTrafficStatistics.numSentMessages = linkStatistics.numSentMessages;
+            linkTrafficStatistics.numReceivedMessages = linkStatistics.numReceivedMessages;
+            trafficStatistics.links.push_back(std::move(linkTrafficStatistics));
+        }
+    });
+
+    return trafficStatistics;
+}
+
 bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSubscriber& subscriber)
 {
     bool wasAdded = false;
@@ -1491,7 +2227,13 @@ bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSub
 void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto receiverIdx =  buffer.GetRemoteIndex();//ExtractEndpointId(buffer);
-    if (receiverIdx >= _vasioReceivers.size())
+    IVAsioReceiver* receiver{nullptr};
+    const auto* receivers = _vasioReceiverTable.load(std::memory_order_acquire);
+    if (receivers != nullptr && receiverIdx < receivers->size())
+    {
+        receiver = (*receivers)[receiverIdx];
+    }
+    if (receiver == nullptr)
     {
         Services::Logging::Warn(_logger, "Ignoring RawSilKitMessage for unknown receiverIdx={}", receiverIdx);
         return;
@@ -1499,11 +2241,14 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    const auto sender = from->GetRemoteServiceEndpoint(endpoint.endpoint);
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    if (IsOffConnectionStrand())
+    {
+        receiver->ReceiveRawMsg(from, sender, std::move(buffer), _ioStrand, _handlerMemoryPool);
+        return;
+    }
+    receiver->ReceiveRawMsg(from, sender, std::move(buffer));
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
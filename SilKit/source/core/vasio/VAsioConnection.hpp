@@ -30,6 +30,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <mutex>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <list>
 
 #include "asio.hpp"
@@ -42,6 +44,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SilKitLink.hpp"
 #include "IVAsioPeer.hpp"
 #include "VAsioReceiver.hpp"
+#include "HandlerMemoryPool.hpp"
 #include "VAsioTransmitter.hpp"
 #include "VAsioMsgKind.hpp"
 #include "IServiceEndpoint.hpp"
@@ -54,6 +57,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TestDataTraits.hpp"
 
 #include "silkit/services/orchestration/string_utils.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 #include "silkit/services/can/string_utils.hpp"
 
 
@@ -65,6 +69,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Core {
 
+class VAsioLazyPeer;
+class VAsioTcpPeer;
+
 class VAsioConnection : public IVAsioPeerConnection
 {
 public:
@@ -97,23 +104,27 @@ public:
     template <class SilKitServiceT>
     void RegisterSilKitService(SilKitServiceT* service)
     {
+        // The services of a registration batch wait for their acknowledges in EndServiceRegistrationBatch
+        const bool waitForAcknowledges =
+            !SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration() && !_isBatchingServiceRegistrations;
+
         std::future<void> allAcked;
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (waitForAcknowledges)
         {
             SILKIT_ASSERT(_pendingSubscriptionAcknowledges.empty());
             _receivedAllSubscriptionAcknowledges = std::promise<void>{};
             allAcked = _receivedAllSubscriptionAcknowledges.get_future();
         }
-        else
+        else if (SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
         {
             _hasPendingAsyncSubscriptions = true;
         }
 
-        asio::post(_ioContext, [this, service]() {
+        asio::post(_ioStrand, [this, service]() {
             this->RegisterSilKitServiceImpl<SilKitServiceT>(service);
         });
 
-        if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
+        if (waitForAcknowledges)
         {
             Trace(_logger, "SIL Kit waiting for subscription acknowledges for SilKitService {}.", typeid(*service).name());
             allAcked.wait();
@@ -138,13 +149,25 @@ public:
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+        const auto pendingSend = ReserveSendQueueSpace<MessageT>();
+        // rvalue messages are moved into the handler, which moves them on to the link
+        ExecuteOnIoThreadPooled([this, from, pendingSend, msg = std::forward<SilKitMessageT>(msg)]() mutable {
+            ReleaseSendQueueSpace(pendingSend);
+            SendMsgImpl<MessageT>(from, std::move(msg));
+        });
     }
 
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        using MessageT = std::decay_t<SilKitMessageT>;
+        const auto pendingSend = ReserveSendQueueSpace<MessageT>();
+        ExecuteOnIoThreadPooled(
+            [this, from, pendingSend, targetParticipantName, msg = std::forward<SilKitMessageT>(msg)]() mutable {
+                ReleaseSendQueueSpace(pendingSend);
+                SendMsgToTargetImpl<MessageT>(from, targetParticipantName, std::move(msg));
+            });
     }
 
     inline void OnAllMessagesDelivered(const std::function<void()>& callback)
@@ -152,10 +175,14 @@ public:
         callback();
     }
 
-    void FlushSendBuffers() {}
+    //! Hold back the simulation messages sent to the peers until FlushSendBuffers, if message coalescing is enabled.
+    //! Both take effect on the connection strand, in order with the messages passed to SendMsg.
+    void StartSendBuffering();
+    void FlushSendBuffers();
+    auto IsBufferingSends() const -> bool { return _isBufferingSends; }
     void ExecuteDeferred(std::function<void()> function)
     {
-        asio::post(_ioContext.get_executor(), std::move(function));
+        asio::post(_ioStrand, std::move(function));
     }
 
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration& override
@@ -191,6 +218,23 @@ public:
     // Register handlers for completion of async service creation
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler);
 
+    //! Services registered until EndServiceRegistrationBatch do not wait for their subscription acknowledges. Their
+    //! subscriptions are announced with a single message per peer, and acknowledged in a single round.
+    void BeginServiceRegistrationBatch();
+    void EndServiceRegistrationBatch();
+
+    //! Called by the peers, whenever their sending queue reaches its limit or drained to half of it again
+    void SetSendQueueHighWaterMarkHandler(SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler handler);
+    void OnSendQueueHighWaterMark(const SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent& event);
+    //! True if called by one of the threads processing the network IO, which must never wait for a peer's queue
+    bool IsIoWorkerThread()
+    {
+        return _ioContext.get_executor().running_in_this_thread();
+    }
+
+    //! The counters of the registry connection and all peers, and of all links
+    auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics;
+
     size_t GetNumberOfConnectedParticipants() 
     { 
         return _peers.size();
@@ -200,6 +244,13 @@ public:
     auto GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName)
         -> std::vector<std::string>;
 
+    //! Create a direct connection to a participant, whose messages are relayed through the registry so far. It carries
+    //! the messages of the services once it is connected. Returns nullptr, if the participant does not accept one.
+    auto CreateDataConnection(VAsioLazyPeer* lazyPeer) -> std::shared_ptr<VAsioTcpPeer>;
+    //! Connect the data connection without blocking the caller. If no acceptor URI of the participant is reached
+    //! within the connect timeout, the lazy peer is notified on the IO strand and keeps relaying its messages.
+    void ConnectDataConnection(VAsioLazyPeer* lazyPeer, std::shared_ptr<VAsioTcpPeer> dataConnection);
+
 public: //members
     static constexpr const ParticipantId RegistryParticipantId { 0 };
 private:
@@ -216,6 +267,19 @@ private:
     template <class MsgT>
     using SilKitServiceToLinkMap = std::map<std::string, std::shared_ptr<SilKitLink<MsgT>>>;
 
+    //! The link a registered service sends its messages of type MsgT on, resolved at registration.
+    template <class MsgT>
+    struct SilKitServiceLinkHandle
+    {
+        const IServiceEndpoint* service{nullptr};
+        SilKitLink<MsgT>* link{nullptr};
+        //! The network of the link, compared by its interned entry instead of the name
+        Util::InternedString networkName;
+    };
+    //! Indexed by the service's endpoint id, which is handed out consecutively per participant.
+    template <class MsgT>
+    using SilKitServiceLinkHandles = std::vector<SilKitServiceLinkHandle<MsgT>>;
+
     using ParticipantAnnouncementReceiver = std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)>;
 
     using SilKitMessageTypes = std::tuple<
@@ -270,6 +334,9 @@ private:
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAnnouncementBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    void ReceiveSubscriptionAcknowledgeBatch(IVAsioPeer* from, SerializedMessage&& buffer);
+    auto AcknowledgeSubscription(IVAsioPeer* from, VAsioMsgSubscriber subscriber) -> SubscriptionAcknowledge;
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveProxyMessage(IVAsioPeer* from, SerializedMessage&& buffer);
 
@@ -286,11 +353,24 @@ private:
     void ReceiveParticipantAnnouncementReply(IVAsioPeer* from, SerializedMessage&& buffer);
 
     void ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessage&& buffer);
+    void ConnectPeer(const VAsioPeerInfo& peerInfo);
+    void OnPeerConnectCompleted(const std::shared_ptr<VAsioTcpPeer>& directPeer, const VAsioPeerInfo& peerInfo,
+                                bool isConnected);
+    void OnDataConnectionConnectCompleted(const std::shared_ptr<VAsioTcpPeer>& dataConnection, bool isConnected);
+    void AddConnectedPeer(std::shared_ptr<IVAsioConnectionPeer> peer, const VAsioPeerInfo& peerInfo);
+    void LogJoinSimulationStep(const std::string& step);
 
     void NotifyNetworkIncompatibility(const RegistryMsgHeader& other, const std::string& otherParticipantName);
 
     void AssociateParticipantNameAndPeer(const std::string& participantName, IVAsioPeer* peer);
 
+    // Lazy peer connections
+    void AcceptDataConnection(IVAsioPeer* from);
+    auto FindDataConnection(IVAsioPeer* peer) -> std::shared_ptr<IVAsioPeer>;
+    auto FindLazyPeer(const std::string& participantName) -> VAsioLazyPeer*;
+    //! Publish the table of the registered receivers, called with _vasioReceiversMx held
+    void PublishVAsioReceivers();
+
     // TCP Related
     void AddPeer(std::shared_ptr<IVAsioPeer> peer);
     template <typename AcceptorT>
@@ -302,6 +382,9 @@ private:
     // Unique identifier of SubscriptionAcknowledges on the subscriber
     using PendingAcksIdentifier = std::pair<IVAsioPeer*, VAsioMsgSubscriber>;
     void RemovePendingSubscription(const PendingAcksIdentifier& ackId);
+    void RemovePendingSubscriptions(IVAsioPeer* from, const std::vector<SubscriptionAcknowledge>& acks);
+    //! Send the subscriptions of the registered services to the peers, batched per peer if supported
+    void FlushSubscriptionAnnouncements();
 
     void SendProxyPeerShutdownNotification(IVAsioPeer* peer);
     void RemovePeerFromLinks(IVAsioPeer* peer);
@@ -348,7 +431,11 @@ private:
             tmpServiceDescriptor.SetParticipantNameAndComputeId(_participantName);
             // copy the Service Endpoint Id
             serviceEndpointPtr->SetServiceDescriptor(tmpServiceDescriptor);
-            _vasioReceivers.emplace_back(std::move(rawReceiver));
+            {
+                std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+                _vasioReceivers.emplace_back(std::move(rawReceiver));
+                PublishVAsioReceivers();
+            }
 
             {
                 std::unique_lock<decltype(_peersLock)> lock{_peersLock};
@@ -366,18 +453,60 @@ private:
                         _pendingAsyncSubscriptionAcknowledges.emplace_back(ackPair);
                     }
 
-                    peer->Subscribe(subscriptionInfo);
+                    // Announced to the peer in FlushSubscriptionAnnouncements
+                    _pendingSubscriptionAnnouncements[peer.get()].push_back(subscriptionInfo);
                 }
             }
         }
     }
 
     template<class SilKitMessageT>
-    void RegisterSilKitMsgSender(const std::string& networkName)
+    void RegisterSilKitMsgSender(const IServiceEndpoint* service)
     {
+        const auto& serviceDescriptor = service->GetServiceDescriptor();
+        const auto& networkName = serviceDescriptor.GetNetworkName();
+
         auto link = GetLinkByName<SilKitMessageT>(networkName);
         auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
         serviceLinkMap[networkName] = link;
+
+        auto&& serviceLinkHandles = std::get<SilKitServiceLinkHandles<SilKitMessageT>>(_serviceLinkHandles);
+        const auto handle = static_cast<size_t>(serviceDescriptor.GetServiceId());
+        if (handle >= serviceLinkHandles.size())
+        {
+            serviceLinkHandles.resize(handle + 1);
+        }
+        serviceLinkHandles[handle] =
+            SilKitServiceLinkHandle<SilKitMessageT>{service, link.get(), serviceDescriptor.GetInternedNetworkName()};
+    }
+
+    //! Returns the link the service sends its messages on, or nullptr if there is none. Services registered as senders
+    //! of the message type are dispatched via their handle, other endpoints fall back to the link of their network.
+    template<class SilKitMessageT>
+    auto GetSenderLink(const IServiceEndpoint* from) -> SilKitLink<SilKitMessageT>*
+    {
+        const auto& serviceDescriptor = from->GetServiceDescriptor();
+
+        auto&& serviceLinkHandles = std::get<SilKitServiceLinkHandles<SilKitMessageT>>(_serviceLinkHandles);
+        const auto handle = static_cast<size_t>(serviceDescriptor.GetServiceId());
+        if (handle < serviceLinkHandles.size())
+        {
+            const auto& serviceLinkHandle = serviceLinkHandles[handle];
+            // the descriptor of a simulator is only temporarily set to each simulated network during registration
+            if (serviceLinkHandle.service == from
+                && serviceLinkHandle.networkName == serviceDescriptor.GetInternedNetworkName())
+            {
+                return serviceLinkHandle.link;
+            }
+        }
+
+        auto&& serviceLinkMap = std::get<SilKitServiceToLinkMap<SilKitMessageT>>(_serviceToLinkMap);
+        auto it = serviceLinkMap.find(serviceDescriptor.GetNetworkName());
+        if (it == serviceLinkMap.end())
+        {
+            return nullptr;
+        }
+        return it->second.get();
     }
 
     template<class SilKitServiceT>
@@ -397,10 +526,18 @@ private:
             [this, service](auto&& message)
         {
             using SilKitMessageT = std::decay_t<decltype(message)>;
-            this->RegisterSilKitMsgSender<SilKitMessageT>(GetServiceDescriptor(service).GetNetworkName());
+            this->RegisterSilKitMsgSender<SilKitMessageT>(&dynamic_cast<IServiceEndpoint&>(*service));
         }
         );
 
+        // The subscriptions of a registration batch are announced in EndServiceRegistrationBatch
+        if (_isRegisteringServiceBatch)
+        {
+            return;
+        }
+
+        FlushSubscriptionAnnouncements();
+
         // We could have registered a receiver that only uses already acknowledged senders, thus no new handshake is 
         // triggered. In that case, the pending acks might be already empty and the subscription is completed.
         if (!SilKitServiceTraits<SilKitServiceT>::UseAsyncRegistration())
@@ -422,14 +559,11 @@ private:
     template <class SilKitMessageT>
     void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from);
+        if (link == nullptr)
         {
-            throw SilKitError{ "SendMsgImpl: sending on empty link for " + key };
+            throw SilKitError{"SendMsgImpl: sending on empty link for " + from->GetServiceDescriptor().GetNetworkName()};
         }
-        auto&& link = linkMap[key];
         link->DistributeLocalSilKitMessage(from, std::forward<SilKitMessageT>(msg));
     }
 
@@ -437,25 +571,67 @@ private:
     void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                    SilKitMessageT&& msg)
     {
-        const auto& key = from->GetServiceDescriptor().GetNetworkName();
-
-        auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
-        if (linkMap.count(key) < 1)
+        auto* link = GetSenderLink<std::decay_t<SilKitMessageT>>(from);
+        if (link == nullptr)
         {
-            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for " + key};
+            throw SilKitError{"SendMsgToTargetImpl: sending on empty link for "
+                              + from->GetServiceDescriptor().GetNetworkName()};
         }
-        auto&& link = linkMap[key];
         link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
-    template <typename... MethodArgs, typename... Args>
-    inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
+    //! A service message handed to SendMsg, which the connection strand did not yet pass on to the peers
+    struct PendingSend
+    {
+        bool isCounted{false};
+    };
+
+    //! Apply the overflow policy of the sending queues to the thread calling SendMsg. The peers only see the
+    //! messages once they run on the connection strand, where they can neither block nor throw to the sender.
+    //! The bytes are only counted by the peers, which know the size of the serialized messages. The messages
+    //! waiting for the strand are not serialized yet, they are limited by their number only.
+    template <typename MessageT>
+    auto ReserveSendQueueSpace() -> PendingSend
     {
-        asio::post(_ioContext.get_executor(), [=]() mutable { (this->*method)(std::move(args)...); });
+        PendingSend pendingSend;
+        // The IO threads must never wait for the queues, which only they drain. DropOldest is applied by the peers.
+        if (!HasBlockingSendQueueLimits() || SilKitMsgTraits<MessageT>::IsControlMsg() || IsIoWorkerThread())
+        {
+            return pendingSend;
+        }
+
+        if (IsSendQueueFull())
+        {
+            HandleSendQueueOverflow();
+        }
+
+        pendingSend.isCounted = true;
+        _numPendingSendMessages.fetch_add(1);
+        return pendingSend;
+    }
+    void ReleaseSendQueueSpace(const PendingSend& pendingSend);
+    bool HasBlockingSendQueueLimits() const;
+    //! True while the queue of a peer is above its high-water mark, or too many messages wait for the strand
+    bool IsSendQueueFull() const;
+    //! Wait until the queues have space again, or throw with the policy Error
+    void HandleSendQueueOverflow();
+    void WakeBlockedSenders();
+
+    //! Post the handler to the connection's strand, recycling the memory of the posted handlers
+    template <typename HandlerT>
+    inline void ExecuteOnIoThreadPooled(HandlerT&& handler)
+    {
+        asio::post(_ioStrand, MakePooledHandler(_handlerMemoryPool, std::forward<HandlerT>(handler)));
     }
     inline void ExecuteOnIoThread(std::function<void()> function)
     {
-        asio::post(_ioContext.get_executor(), std::move(function));
+        asio::post(_ioStrand, std::move(function));
+    }
+
+    //! True if data received by peers must be handed over to the connection's strand.
+    inline bool IsOffConnectionStrand() const
+    {
+        return _numIoWorkers > 1 && !_ioStrand.running_in_this_thread();
     }
 
     template <class SilKitServiceT>
@@ -472,6 +648,8 @@ private:
     ParticipantId _participantId{0};
     Services::Logging::ILogger* _logger{nullptr};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
+    //! Fixed at construction, because it is read by the IO workers while they are still being started
+    const int _numIoWorkers;
 
     mutable std::mutex _linksMx;
 
@@ -479,21 +657,37 @@ private:
     Util::tuple_tools::wrapped_tuple<SilKitLinkMap, SilKitMessageTypes> _links;
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
+    //! \brief Links of the registered senders by their endpoint id, only accessed on the connection's strand.
+    Util::tuple_tools::wrapped_tuple<SilKitServiceLinkHandles, SilKitMessageTypes> _serviceLinkHandles;
 
+    //! Only modified on the connection's strand, but read by the IO worker threads receiving simulation messages.
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! The receivers by their index, read without locking when receiving simulation messages. Every registration
+    //! publishes a new table, the previous ones are kept until the connection is destroyed.
+    std::atomic<const std::vector<IVAsioReceiver*>*> _vasioReceiverTable{nullptr};
+    std::vector<std::unique_ptr<const std::vector<IVAsioReceiver*>>> _vasioReceiverTables;
+    //! Serializes the registrations of receivers
+    mutable std::mutex _vasioReceiversMx;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
     std::mutex _participantAnnouncementReceiversMutex;
     std::vector<ParticipantAnnouncementReceiver> _participantAnnouncementReceivers;
     std::vector<std::function<void(IVAsioPeer*)>> _peerShutdownCallbacks;
 
+    //! Memory of the handlers posted by SendMsg. Must be listed before the IO context, which may still own handlers.
+    HandlerMemoryPool _handlerMemoryPool;
+
     // NB: The IO context must be listed before anything socket related.
     asio::io_context _ioContext;
+    //! The state of the connection is only accessed on this strand. Each peer uses a separate strand for its socket.
+    asio::strand<asio::io_context::executor_type> _ioStrand;
 
     // NB: peers and acceptors must be listed AFTER the io_context. Otherwise,
     // their destructor will crash!
     std::shared_ptr<IVAsioPeer> _registry{nullptr};
     std::vector<std::shared_ptr<IVAsioPeer>> _peers;
+    // Direct connections carrying the service messages of lazily connected participants, see VAsioLazyPeer
+    std::vector<std::shared_ptr<IVAsioPeer>> _dataConnections;
 
     // We support IPv6, IPv4 and Local Domain sockets for incoming connections. The address of the acceptor objects
     // must be stable, so either keep this a std::list, or turn it into a std::vector<std::unique_ptr<...>>.
@@ -508,6 +702,10 @@ private:
 
     std::atomic<bool> _hasReceivedKnownParticipants{false};
 
+    // The connects to all known participants and their handshakes must be completed before the deadline
+    std::chrono::steady_clock::time_point _joinSimulationStart;
+    std::chrono::steady_clock::time_point _joinSimulationDeadline;
+
     // Keep track of the sent Subscriptions when Registering an SIL Kit Service
     std::vector<PendingAcksIdentifier> _pendingSubscriptionAcknowledges;
     std::promise<void> _receivedAllSubscriptionAcknowledges;
@@ -517,14 +715,36 @@ private:
     std::function<void()> _asyncSubscriptionsCompletionHandler;
     std::atomic<bool> _hasPendingAsyncSubscriptions{false};
 
-    // The worker thread should be the last members in this class. This ensures
-    // that no callback is destroyed before the thread finishes.
-    std::thread _ioWorker;
+    // Subscriptions of the registered services, which are not yet announced to the peers
+    std::map<IVAsioPeer*, std::vector<VAsioMsgSubscriber>> _pendingSubscriptionAnnouncements;
+    // Accessed by the registering thread
+    bool _isBatchingServiceRegistrations{false};
+    // Accessed on the connection strand
+    bool _isRegisteringServiceBatch{false};
+
+    // The worker threads should be the last members in this class. This ensures
+    // that no callback is destroyed before the threads finish.
+    std::vector<std::thread> _ioWorkers;
 
     //We violate the strict layering architecture, so that we can cleanly shutdown without false error messages.
     std::atomic_bool _isShuttingDown{false};
+    // Simulation messages are held back by the peers, until the end of the simulation step. Set on the strand.
+    std::atomic_bool _isBufferingSends{false};
     // Lock access to _peers in ~VAsioConnection and (async) OnPeerShutdown
     std::mutex _peersLock;
+    // Lock access to _dataConnections, which are opened while sending a message to a VAsioLazyPeer
+    std::mutex _dataConnectionsMutex;
+    // Called by the sending threads and the IO threads
+    std::mutex _sendQueueHighWaterMarkHandlerMutex;
+    SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler _sendQueueHighWaterMarkHandler;
+    // Limits of the sending queues, applied to the threads calling SendMsg, see ReserveSendQueueSpace
+    const std::size_t _sendQueueMaxBytes;
+    const std::size_t _sendQueueMaxMessages;
+    std::atomic<int> _numFullSendQueues{0};
+    std::atomic<std::size_t> _numPendingSendMessages{0};
+    std::atomic<int> _numBlockedSenders{0};
+    std::mutex _sendQueueSpaceMutex;
+    std::condition_variable _sendQueueSpaceAvailable;
 
     // Hold mapping from hash to participantName
     std::map<uint64_t, std::string> _hashToParticipantName;
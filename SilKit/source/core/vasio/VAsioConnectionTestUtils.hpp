@@ -0,0 +1,329 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+// fowards required for TestDataTypes because of  SilKitMsgTraits
+#include "silkit/services/can/fwd_decl.hpp"
+#include "silkit/services/ethernet/fwd_decl.hpp"
+#include "silkit/services/flexray/fwd_decl.hpp"
+#include "silkit/services/lin/fwd_decl.hpp"
+#include "silkit/services/pubsub/fwd_decl.hpp"
+#include "silkit/services/rpc/fwd_decl.hpp"
+#include "silkit/services/orchestration/fwd_decl.hpp"
+#include "silkit/services/logging/fwd_decl.hpp"
+
+// internal types required for TestDataTypes because of SilKitMsgTraits
+#include "WireCanMessages.hpp"
+#include "WireDataMessages.hpp"
+#include "WireEthernetMessages.hpp"
+#include "WireFlexrayMessages.hpp"
+#include "WireLinMessages.hpp"
+#include "WireRpcMessages.hpp"
+
+#include "ServiceDatatypes.hpp" //concrete, no forwards
+#include "RequestReplyDatatypes.hpp" //concrete, no forwards
+#include "LoggingDatatypesInternal.hpp" //concrete, no forwards
+#include "OrchestrationDatatypes.hpp" //concrete, no forwards
+
+#include "ProtocolVersion.hpp"
+#include "TestDataTypes.hpp" // must be included before VAsioConnection
+
+#include "IVAsioPeer.hpp"
+#include "IMessageReceiver.hpp"
+#include "RemoteServiceEndpoint.hpp"
+
+#include "VAsioConnection.hpp"
+#include "VAsioLazyPeer.hpp"
+#include "VAsioCapabilities.hpp"
+#include "MockParticipant.hpp" // for DummyLogger
+#include "VAsioSerdes.hpp"
+#include "SerializedMessage.hpp"
+#include "TimeProvider.hpp"
+
+#include "ILogger.hpp"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace SilKit {
+namespace Core {
+namespace Tests {
+
+struct MockVAsioPeer
+    : public IVAsioPeer
+    , public IServiceEndpoint
+{
+    VAsioPeerInfo _peerInfo;
+    ServiceDescriptor _serviceDescriptor;
+    ProtocolVersion _protocolVersion;
+
+    MockVAsioPeer()
+    {
+        _peerInfo.participantId = 1234;
+        _peerInfo.participantName = "MockVAsioPeer";
+        _peerInfo.acceptorUris.push_back("tcp://localhost:1234");
+
+        _serviceDescriptor.SetServiceId(1);
+        _serviceDescriptor.SetParticipantNameAndComputeId(_peerInfo.participantName);
+
+        _protocolVersion = CurrentProtocolVersion();
+
+        ON_CALL(*this, GetLocalAddress()).WillByDefault(testing::Return("127.0.0.1"));
+        ON_CALL(*this, GetRemoteAddress()).WillByDefault(testing::Return("127.0.0.1"));
+        ON_CALL(*this, GetInfo()).WillByDefault(testing::ReturnRef(_peerInfo));
+        ON_CALL(*this, GetServiceDescriptor()).WillByDefault(testing::ReturnRef(_serviceDescriptor));
+        ON_CALL(*this, GetProtocolVersion()).WillByDefault(testing::Return(_protocolVersion));
+        ON_CALL(*this, GetRemoteServiceEndpoint(testing::_)).WillByDefault([this](EndpointId endpointId) {
+            return _remoteServiceEndpoints.Get(_serviceDescriptor, endpointId);
+        });
+    }
+
+    RemoteServiceEndpointCache _remoteServiceEndpoints;
+
+    // IVasioPeer
+    MOCK_METHOD(void, SendSilKitMsg, (SerializedMessage), (override));
+    MOCK_METHOD(void, Subscribe, (VAsioMsgSubscriber), (override));
+    MOCK_METHOD(const VAsioPeerInfo&, GetInfo, (), (const, override));
+    MOCK_METHOD(void, SetInfo, (VAsioPeerInfo), (override));
+    MOCK_METHOD(std::string, GetRemoteAddress, (), (const, override));
+    MOCK_METHOD(std::string, GetLocalAddress, (), (const, override));
+    MOCK_METHOD(void, StartAsyncRead, (), (override));
+    MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
+    MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
+    MOCK_METHOD(DrainStatistics, DrainAllBuffers, (), (override));
+    MOCK_METHOD(PeerStatistics, GetPeerStatistics, (), (const, override));
+    MOCK_METHOD(void, FlushSendBuffers, (), (override));
+    MOCK_METHOD(std::shared_ptr<const RemoteServiceEndpoint>, GetRemoteServiceEndpoint, (EndpointId), (override));
+
+    // IServiceEndpoint
+    MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
+    MOCK_METHOD(const ServiceDescriptor&, GetServiceDescriptor, (), (override, const));
+};
+
+// Receiving side of the allocation benchmark, free of mocks which allocate on every call
+struct CountingTestFrameEventReceiver
+    : public IMessageReceiver<Tests::TestFrameEvent>
+    , public IServiceEndpoint
+{
+    ServiceDescriptor _serviceDescriptor;
+    std::atomic<size_t> numReceived{0};
+
+    CountingTestFrameEventReceiver(const std::string& networkName = "", EndpointId serviceId = 1000)
+    {
+        _serviceDescriptor.SetServiceId(serviceId);
+        _serviceDescriptor.SetServiceType(ServiceType::Controller);
+        _serviceDescriptor.SetParticipantNameAndComputeId("CountingReceiver");
+        _serviceDescriptor.SetNetworkName(networkName);
+    }
+
+    void ReceiveMsg(const SilKit::Core::IServiceEndpoint*, const Tests::TestFrameEvent&) override
+    {
+        ++numReceived;
+    }
+
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+};
+
+struct BenchmarkVAsioPeer
+    : public IVAsioPeer
+    , public IServiceEndpoint
+{
+    VAsioPeerInfo _peerInfo;
+    ServiceDescriptor _serviceDescriptor;
+    RemoteServiceEndpointCache _remoteServiceEndpoints;
+
+    BenchmarkVAsioPeer()
+    {
+        _peerInfo.participantName = "BenchmarkVAsioPeer";
+
+        // a descriptor as announced by a data publisher, with the supplemental data of its topic
+        _serviceDescriptor.SetParticipantNameAndComputeId(_peerInfo.participantName);
+        _serviceDescriptor.SetNetworkName("BenchmarkTopicNetwork");
+        _serviceDescriptor.SetServiceName("BenchmarkDataPublisherController");
+        _serviceDescriptor.SetSupplementalDataItem("controllerType", "DataPublisher");
+        _serviceDescriptor.SetSupplementalDataItem("topic", "BenchmarkTopicNetwork");
+        _serviceDescriptor.SetSupplementalDataItem("mediaType", "application/octet-stream");
+        _serviceDescriptor.SetSupplementalDataItem("labels", "- key: Label\n  value: BenchmarkValue\n  kind: 2");
+    }
+
+    void SendSilKitMsg(SerializedMessage) override {}
+    void Subscribe(VAsioMsgSubscriber) override {}
+    auto GetInfo() const -> const VAsioPeerInfo& override { return _peerInfo; }
+    void SetInfo(VAsioPeerInfo info) override { _peerInfo = std::move(info); }
+    auto GetRemoteAddress() const -> std::string override { return {}; }
+    auto GetLocalAddress() const -> std::string override { return {}; }
+    void StartAsyncRead() override {}
+    auto DrainAllBuffers() -> DrainStatistics override { return {}; }
+    auto GetPeerStatistics() const -> PeerStatistics override { return {}; }
+    void FlushSendBuffers() override {}
+    void SetProtocolVersion(ProtocolVersion) override {}
+    auto GetProtocolVersion() const -> ProtocolVersion override { return CurrentProtocolVersion(); }
+    auto GetRemoteServiceEndpoint(EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint> override
+    {
+        return _remoteServiceEndpoints.Get(_serviceDescriptor, endpointId);
+    }
+
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+        _remoteServiceEndpoints.Clear();
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override { return _serviceDescriptor; }
+};
+
+struct TestServiceEndpoint : public IServiceEndpoint
+{
+    ServiceDescriptor _serviceDescriptor;
+
+    TestServiceEndpoint(const std::string& networkName, EndpointId endpointId)
+    {
+        _serviceDescriptor.SetParticipantNameAndComputeId("VAsioConnectionTest");
+        _serviceDescriptor.SetNetworkName(networkName);
+        _serviceDescriptor.SetServiceName("Sender");
+        _serviceDescriptor.SetServiceId(endpointId);
+    }
+
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+};
+
+struct SilentLogger : public SilKit::Services::Logging::ILogger
+{
+    void Log(SilKit::Services::Logging::Level, const std::string&) override {}
+    void Trace(const std::string&) override {}
+    void Debug(const std::string&) override {}
+    void Info(const std::string&) override {}
+    void Warn(const std::string&) override {}
+    void Error(const std::string&) override {}
+    void Critical(const std::string&) override {}
+    auto GetLogLevel() const -> SilKit::Services::Logging::Level override
+    {
+        return SilKit::Services::Logging::Level::Off;
+    }
+};
+
+//! A participant which can only be reached through the registry, recording the bytes relayed to it
+struct ProxiedParticipantPeer : public BenchmarkVAsioPeer
+{
+    bool recordSentMessages{true};
+    std::vector<std::vector<uint8_t>> sentMessages;
+
+    explicit ProxiedParticipantPeer(const std::string& participantName)
+    {
+        _peerInfo.participantName = participantName;
+    }
+
+    void SendSilKitMsg(SerializedMessage message) override
+    {
+        if (recordSentMessages)
+        {
+            sentMessages.emplace_back(message.ReleaseStorage());
+        }
+    }
+};
+
+inline auto MakeProxyMessageBlob(const std::string& source, const std::string& destination, size_t payloadSize)
+    -> std::vector<uint8_t>
+{
+    Tests::TestFrameEvent frameEvent{};
+    frameEvent.str.assign(payloadSize, 'x');
+
+    ProxyMessage proxyMessage{};
+    proxyMessage.source = source;
+    proxyMessage.destination = destination;
+    proxyMessage.payload = SerializedMessage{frameEvent, EndpointAddress{1, 2}, 3}.ReleaseStorage();
+    return SerializedMessage{proxyMessage}.ReleaseStorage();
+
+} // namespace Tests
+
+//////////////////////////////////////////////////////////////////////
+// Test Fixture, shared by the unit tests and the benchmarks of the VAsioConnection
+//////////////////////////////////////////////////////////////////////
+
+class VAsioConnectionTest : public testing::Test
+{
+protected:
+    VAsioConnectionTest()
+        : _connection({}, "VAsioConnectionTest", 1, &_timeProvider)
+    {
+        _connection.SetLogger(&_dummyLogger);
+    }
+    Services::Orchestration::TimeProvider _timeProvider;
+    VAsioConnection _connection;
+    Tests::MockVAsioPeer _from;
+    Tests::MockLogger _dummyLogger;
+
+    //we are a friend class
+    // - allow selected access to private member
+    template<typename MessageT, typename ServiceT>
+    void RegisterSilKitMsgReceiver(SilKit::Core::IMessageReceiver<MessageT>* receiver)
+    {
+        _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
+    }
+
+    template <typename MessageT>
+    void RegisterSilKitMsgSender(const IServiceEndpoint* sender)
+    {
+        _connection.RegisterSilKitMsgSender<MessageT>(sender);
+    }
+
+    void AddParticipantPeer(IVAsioPeer* peer)
+    {
+        _connection._participantNameToPeer[peer->GetInfo().participantName] = peer;
+    }
+
+    template <typename MessageT>
+    void SendMsgImpl(const IServiceEndpoint* from, const MessageT& msg)
+    {
+        _connection.SendMsgImpl<const MessageT&>(from, msg);
+    }
+    static bool IsOffConnectionStrand(const VAsioConnection& connection)
+    {
+        return connection.IsOffConnectionStrand();
+    }
+    static auto FindParticipantPeer(const VAsioConnection& connection, const std::string& participantName)
+        -> IVAsioPeer*
+    {
+        auto it = connection._participantNameToPeer.find(participantName);
+        return it == connection._participantNameToPeer.end() ? nullptr : it->second;
+    }
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -69,6 +69,17 @@ struct SubscriptionAcknowledge
     VAsioMsgSubscriber subscriber;
 };
 
+//! Multiple subscriptions announced to a peer, which are acknowledged with a single SubscriptionAcknowledgeBatch
+struct SubscriptionAnnouncementBatch
+{
+    std::vector<VAsioMsgSubscriber> subscribers;
+};
+
+struct SubscriptionAcknowledgeBatch
+{
+    std::vector<SubscriptionAcknowledge> acknowledges;
+};
+
 struct ParticipantAnnouncement
 {
     RegistryMsgHeader messageHeader;
@@ -123,6 +134,30 @@ struct ProxyMessage
     std::vector<uint8_t> payload;
 };
 
+//! The leading members of a ProxyMessage, which are sufficient for relaying it without touching its payload
+struct ProxyMessageRouting
+{
+    ProxyMessageHeader header{0};
+    std::string source;
+    std::string destination;
+};
+
+enum class SharedMemoryMessageKind : uint8_t
+{
+    Invalid = 0,
+    Announcement = 1, //!< The connecting peer offers a shared memory segment
+    Accepted = 2, //!< The accepting peer opened the segment and sends via shared memory from now on
+    Rejected = 3, //!< The accepting peer cannot use the segment, both peers keep using the socket
+    DataAvailable = 4, //!< The receiving ring of the remote peer is not empty anymore
+    SpaceAvailable = 5, //!< The sending ring of the remote peer is not full anymore
+};
+
+struct SharedMemoryMessage
+{
+    SharedMemoryMessageKind kind{SharedMemoryMessageKind::Invalid};
+    std::string segmentName;
+};
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -0,0 +1,200 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "VAsioLazyPeer.hpp"
+#include "VAsioConnection.hpp"
+#include "VAsioTcpPeer.hpp"
+
+#include "Logger.hpp"
+
+
+namespace {
+using SilKit::Services::Logging::Debug;
+} // namespace
+
+
+namespace SilKit {
+namespace Core {
+
+VAsioLazyPeer::VAsioLazyPeer(VAsioConnection* connection, VAsioPeerInfo peerInfo, IVAsioPeer* registry,
+                             SilKit::Services::Logging::ILogger* logger)
+    : VAsioProxyPeer{connection, std::move(peerInfo), registry, logger}
+    , _connection{connection}
+    , _logger{logger}
+{
+}
+
+// ================================================================================
+//  IVAsioPeer via VAsioProxyPeer
+// ================================================================================
+
+void VAsioLazyPeer::SendSilKitMsg(SerializedMessage buffer)
+{
+    if (IsRelayed(buffer))
+    {
+        VAsioProxyPeer::SendSilKitMsg(std::move(buffer));
+        return;
+    }
+
+    std::shared_ptr<VAsioTcpPeer> connectingDataConnection;
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (_dataConnectionState == DataConnectionState::None && OpensDataConnection(buffer))
+        {
+            connectingDataConnection = _connection->CreateDataConnection(this);
+            _dataConnection = connectingDataConnection;
+            _dataConnectionState =
+                _dataConnection ? DataConnectionState::Connecting : DataConnectionState::Unavailable;
+        }
+
+        switch (_dataConnectionState)
+        {
+        case DataConnectionState::Connecting:
+            _pendingMessages.emplace_back(std::move(buffer));
+            break;
+        case DataConnectionState::Established:
+            _dataConnection->SendSilKitMsg(std::move(buffer));
+            break;
+        default:
+            VAsioProxyPeer::SendSilKitMsg(std::move(buffer));
+            break;
+        }
+    }
+
+    // The connect completes on the IO strand, which must not wait for the mutex of this peer
+    if (connectingDataConnection)
+    {
+        _connection->ConnectDataConnection(this, std::move(connectingDataConnection));
+    }
+}
+
+auto VAsioLazyPeer::DrainAllBuffers() -> DrainStatistics
+{
+    const auto dataConnection = GetDataConnection();
+    if (dataConnection)
+    {
+        return dataConnection->DrainAllBuffers();
+    }
+    return {};
+}
+
+auto VAsioLazyPeer::GetPeerStatistics() const -> PeerStatistics
+{
+    auto peerStatistics = VAsioProxyPeer::GetPeerStatistics();
+
+    const auto dataConnection = GetDataConnection();
+    if (dataConnection)
+    {
+        const auto dataConnectionStatistics = dataConnection->GetPeerStatistics();
+        peerStatistics.numSentMessages += dataConnectionStatistics.numSentMessages;
+        peerStatistics.numSentBytes += dataConnectionStatistics.numSentBytes;
+        peerStatistics.numWrites = dataConnectionStatistics.numWrites;
+        peerStatistics.maxQueuedMessages = dataConnectionStatistics.maxQueuedMessages;
+        peerStatistics.maxQueuedBytes = dataConnectionStatistics.maxQueuedBytes;
+        peerStatistics.numReceivedMessages += dataConnectionStatistics.numReceivedMessages;
+        peerStatistics.numReceivedBytes += dataConnectionStatistics.numReceivedBytes;
+    }
+    return peerStatistics;
+}
+
+void VAsioLazyPeer::FlushSendBuffers()
+{
+    const auto dataConnection = GetDataConnection();
+    if (dataConnection)
+    {
+        dataConnection->FlushSendBuffers();
+    }
+}
+
+// ================================================================================
+//  VAsioLazyPeer
+// ================================================================================
+
+void VAsioLazyPeer::OnDataConnectionEstablished(const std::shared_ptr<IVAsioPeer>& dataConnection)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    const bool isAdopted = _dataConnectionState == DataConnectionState::None;
+    const bool isPending =
+        _dataConnectionState == DataConnectionState::Connecting && _dataConnection == dataConnection;
+    if (!isAdopted && !isPending)
+    {
+        return;
+    }
+
+    Debug(_logger, "VAsioLazyPeer ({}): Sending messages via the {} data connection", GetInfo().participantName,
+          isAdopted ? "inbound" : "outbound");
+
+    _dataConnection = dataConnection;
+    _dataConnectionState = DataConnectionState::Established;
+
+    for (auto& pendingMessage : _pendingMessages)
+    {
+        _dataConnection->SendSilKitMsg(std::move(pendingMessage));
+    }
+    _pendingMessages.clear();
+}
+
+void VAsioLazyPeer::OnDataConnectionLost(IVAsioPeer* dataConnection)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_dataConnection.get() != dataConnection)
+    {
+        return;
+    }
+
+    Debug(_logger, "VAsioLazyPeer ({}): Data connection is unavailable, relaying messages through the registry",
+          GetInfo().participantName);
+
+    _dataConnection.reset();
+    _dataConnectionState = DataConnectionState::Unavailable;
+
+    for (auto& pendingMessage : _pendingMessages)
+    {
+        VAsioProxyPeer::SendSilKitMsg(std::move(pendingMessage));
+    }
+    _pendingMessages.clear();
+}
+
+bool VAsioLazyPeer::IsRelayed(const SerializedMessage& buffer)
+{
+    // The handshake and the subscriptions are exchanged before any data connection exists
+    return !IsMwOrSim(buffer.GetMessageKind());
+}
+
+bool VAsioLazyPeer::OpensDataConnection(const SerializedMessage& buffer)
+{
+    // The time synchronization of every pair of participants would open all direct connections in the first
+    // simulation step. These messages take the data connection only, once a service message opened it.
+    return !buffer.IsBroadcastMsg() && !buffer.IsControlMsg();
+}
+
+auto VAsioLazyPeer::GetDataConnection() const -> std::shared_ptr<IVAsioPeer>
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    return _dataConnectionState == DataConnectionState::Established ? _dataConnection : nullptr;
+}
+
+} // namespace Core
+} // namespace SilKit
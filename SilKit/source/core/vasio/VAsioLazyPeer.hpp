@@ -0,0 +1,87 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "VAsioProxyPeer.hpp"
+
+namespace SilKit {
+namespace Core {
+
+class VAsioConnection;
+
+//! A participant whose messages are relayed through the registry, until a service sends it its first message.
+//! All messages of the services are then sent over a direct connection, which is opened on demand. This includes the
+//! broadcast messages and the time synchronization and lifecycle messages, which must not overtake the service
+//! messages sent before them. The handshake and the subscriptions are always relayed.
+class VAsioLazyPeer : public VAsioProxyPeer
+{
+public:
+    VAsioLazyPeer(VAsioConnection* connection, VAsioPeerInfo peerInfo, IVAsioPeer* registry,
+                  SilKit::Services::Logging::ILogger* logger);
+
+public: // IVAsioPeer via VAsioProxyPeer
+    void SendSilKitMsg(SerializedMessage buffer) override;
+    auto DrainAllBuffers() -> DrainStatistics override;
+    //! The messages relayed via the registry, and those exchanged via the data connection
+    auto GetPeerStatistics() const -> PeerStatistics override;
+    void FlushSendBuffers() override;
+
+public:
+    //! The remote participant accepted the data connection. An inbound data connection is adopted, if this peer has
+    //! not opened one itself yet.
+    void OnDataConnectionEstablished(const std::shared_ptr<IVAsioPeer>& dataConnection);
+    //! The handshake of the data connection failed or the connection was closed. Messages are relayed from now on.
+    void OnDataConnectionLost(IVAsioPeer* dataConnection);
+
+    auto GetDataConnection() const -> std::shared_ptr<IVAsioPeer>;
+
+private:
+    enum class DataConnectionState
+    {
+        None,
+        Connecting,
+        Established,
+        Unavailable
+    };
+
+private:
+    static bool IsRelayed(const SerializedMessage& buffer);
+    static bool OpensDataConnection(const SerializedMessage& buffer);
+
+private:
+    VAsioConnection* _connection;
+    SilKit::Services::Logging::ILogger* _logger;
+
+    mutable std::mutex _mutex;
+    DataConnectionState _dataConnectionState{DataConnectionState::None};
+    std::shared_ptr<IVAsioPeer> _dataConnection;
+    // messages sent while the data connection is connecting or its handshake is pending, in the order they were sent
+    std::vector<SerializedMessage> _pendingMessages;
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -34,6 +34,10 @@ enum class VAsioMsgKind: uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SilKitSharedMemoryMessage = 7, // 3.1 with "shared-memory" capability
+    SubscriptionAnnouncementBatch = 8, // 3.1 with "subscription-batch" capability
+    SubscriptionAcknowledgeBatch = 9, // 3.1 with "subscription-batch" capability
+    SilKitSimMsgCompact = 10, // 3.1 with "compact-header" capability, read as SilKitSimMsg
 };
 
 } // namespace Core
@@ -57,6 +57,9 @@ void VAsioProxyPeer::SendSilKitMsg(SerializedMessage buffer)
 
     Trace(_logger, "VAsioProxyPeer ({}): SendSilKitMsg({})", _peerInfo.participantName, msg.payload.size());
 
+    _numSentMessages.fetch_add(1, std::memory_order_relaxed);
+    _numSentBytes.fetch_add(msg.payload.size(), std::memory_order_relaxed);
+
     _peer->SendSilKitMsg(SerializedMessage{msg});
 }
 
@@ -92,9 +95,26 @@ void VAsioProxyPeer::StartAsyncRead()
     Debug(_logger, "VAsioProxyPeer ({}): StartAsyncRead: Ignored", _peerInfo.participantName);
 }
 
-void VAsioProxyPeer::DrainAllBuffers()
+auto VAsioProxyPeer::DrainAllBuffers() -> DrainStatistics
 {
     Debug(_logger, "VAsioProxyPeer ({}): DrainAllBuffers: Ignored", _peerInfo.participantName);
+    return {};
+}
+
+auto VAsioProxyPeer::GetPeerStatistics() const -> PeerStatistics
+{
+    // the messages are written and queued by the proxy
+    PeerStatistics peerStatistics;
+    peerStatistics.numSentMessages = _numSentMessages.load(std::memory_order_relaxed);
+    peerStatistics.numSentBytes = _numSentBytes.load(std::memory_order_relaxed);
+    peerStatistics.numReceivedMessages = _numReceivedMessages.load(std::memory_order_relaxed);
+    peerStatistics.numReceivedBytes = _numReceivedBytes.load(std::memory_order_relaxed);
+    return peerStatistics;
+}
+
+void VAsioProxyPeer::FlushSendBuffers()
+{
+    // proxy messages are never held back
 }
 
 void VAsioProxyPeer::SetProtocolVersion(ProtocolVersion v)
@@ -109,6 +129,11 @@ auto VAsioProxyPeer::GetProtocolVersion() const -> ProtocolVersion
     return _protocolVersion;
 }
 
+auto VAsioProxyPeer::GetRemoteServiceEndpoint(EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint>
+{
+    return _remoteServiceEndpoints.Get(_serviceDescriptor, endpointId);
+}
+
 // ================================================================================
 //  IServiceEndpoint via IVAsioConnectionPeer
 // ================================================================================
@@ -116,6 +141,7 @@ auto VAsioProxyPeer::GetProtocolVersion() const -> ProtocolVersion
 void VAsioProxyPeer::SetServiceDescriptor(ServiceDescriptor const &serviceDescriptor)
 {
     _serviceDescriptor = serviceDescriptor;
+    _remoteServiceEndpoints.Clear();
 }
 
 auto VAsioProxyPeer::GetServiceDescriptor() const -> ServiceDescriptor const &
@@ -152,5 +178,11 @@ auto VAsioProxyPeer::GetPeer() const -> IVAsioPeer *
     return _peer;
 }
 
+void VAsioProxyPeer::CountReceivedMessage(std::size_t numBytes)
+{
+    _numReceivedMessages.fetch_add(1, std::memory_order_relaxed);
+    _numReceivedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -21,8 +21,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <atomic>
+
 #include "IVAsioConnectionPeer.hpp"
 #include "IVAsioPeerConnection.hpp"
+#include "RemoteServiceEndpoint.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -54,9 +57,12 @@ public: // IVAsioPeer via IVAsioConnectionPeer
     auto GetRemoteAddress() const -> std::string override;
     auto GetLocalAddress() const -> std::string override;
     void StartAsyncRead() override;
-    void DrainAllBuffers() override;
+    auto DrainAllBuffers() -> DrainStatistics override;
+    auto GetPeerStatistics() const -> PeerStatistics override;
+    void FlushSendBuffers() override;
     void SetProtocolVersion(ProtocolVersion v) override;
     auto GetProtocolVersion() const -> ProtocolVersion override;
+    auto GetRemoteServiceEndpoint(EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint> override;
 
 public: // IServiceEndpoint via IVAsioConnectionPeer
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override;
@@ -70,14 +76,22 @@ public: // IVAsioPeerConnection
 
 public:
     auto GetPeer() const -> IVAsioPeer*;
+    //! Count a message relayed by the proxy, whose payload is dispatched by the connection on behalf of this peer
+    void CountReceivedMessage(std::size_t numBytes);
 
 private:
     IVAsioPeerConnection* _connection;
     IVAsioPeer* _peer;
     VAsioPeerInfo _peerInfo;
     ServiceDescriptor _serviceDescriptor;
+    RemoteServiceEndpointCache _remoteServiceEndpoints;
     SilKit::Services::Logging::ILogger* _logger;
     ProtocolVersion _protocolVersion;
+
+    std::atomic<uint64_t> _numSentMessages{0};
+    std::atomic<uint64_t> _numSentBytes{0};
+    std::atomic<uint64_t> _numReceivedMessages{0};
+    std::atomic<uint64_t> _numReceivedBytes{0};
 };
 
 } // namespace Core
@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include "asio.hpp"
+
 #include "SilKitLink.hpp"
 
 #include "VAsioDatatypes.hpp"
@@ -28,31 +30,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MessageTracing.hpp"
 #include "IServiceEndpoint.hpp"
 #include "SerializedMessage.hpp"
+#include "RemoteServiceEndpoint.hpp"
+#include "HandlerMemoryPool.hpp"
 
 namespace SilKit {
 namespace Core {
 
-struct RemoteServiceEndpoint : IServiceEndpoint
-{
-    void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
-    {
-        throw LogicError("This method is not supposed to be used in this struct.");
-    }
-
-    auto GetServiceDescriptor() const -> const ServiceDescriptor & override
-    {
-        return _serviceDescriptor; 
-    }
-
-    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
-    {
-        _serviceDescriptor = descriptor;
-    }
-
-private:
-    ServiceDescriptor _serviceDescriptor;
-};
-
 class MessageBuffer;
 
 class IVAsioReceiver
@@ -62,7 +45,13 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                               SerializedMessage&& buffer) = 0;
+    //! Deserialize the message on the calling thread, and distribute it to the link on the given executor.
+    //! The posted handlers are allocated from the given pool.
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                               SerializedMessage&& buffer, const asio::any_io_executor& distributionExecutor,
+                               HandlerMemoryPool& handlerMemoryPool) = 0;
 };
 
 template <class MsgT>
@@ -79,7 +68,11 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                       SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                       SerializedMessage&& buffer, const asio::any_io_executor& distributionExecutor,
+                       HandlerMemoryPool& handlerMemoryPool) override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -89,6 +82,11 @@ public:
         return _serviceDescriptor;
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+    void Distribute(const RemoteServiceEndpoint& sender, MsgT&& msg);
+
 private:
     // ----------------------------------------
     // private members
@@ -117,15 +115,31 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                                        SerializedMessage&& buffer)
 {
     MsgT msg = buffer.Deserialize<MsgT>();
+    Distribute(*sender, std::move(msg));
+}
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+template <class MsgT>
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const std::shared_ptr<const RemoteServiceEndpoint>& sender,
+                                        SerializedMessage&& buffer, const asio::any_io_executor& distributionExecutor,
+                                        HandlerMemoryPool& handlerMemoryPool)
+{
+    MsgT msg = buffer.Deserialize<MsgT>();
+    // the cached sender endpoint is shared with the posted handler, not copied
+    asio::post(distributionExecutor, MakePooledHandler(handlerMemoryPool, [this, sender, msg = std::move(msg)]() mutable {
+        Distribute(*sender, std::move(msg));
+    }));
+}
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+template <class MsgT>
+void VAsioReceiver<MsgT>::Distribute(const RemoteServiceEndpoint& sender, MsgT&& msg)
+{
+    Services::TraceRx(_logger, this, msg, sender.GetServiceDescriptor());
 
+    _link->DistributeRemoteSilKitMessage(&sender, std::move(msg));
 }
 
 } // namespace Core
@@ -103,6 +103,30 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledge&
     return buffer;
 }
 
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& batch)
+{
+    buffer << batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAnnouncementBatch& batch)
+{
+    buffer >> batch.subscribers;
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& batch)
+{
+    buffer << batch.acknowledges;
+    return buffer;
+}
+
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& batch)
+{
+    buffer >> batch.acknowledges;
+    return buffer;
+}
+
 inline MessageBuffer& operator<<(MessageBuffer& buffer, const ParticipantAnnouncement& announcement)
 {
     // ParticipantAnnouncement is the first message sent during a handshake.
@@ -282,6 +306,41 @@ inline MessageBuffer& operator>>(MessageBuffer& buffer, ProxyMessage& out)
     return buffer;
 }
 
+inline MessageBuffer& operator>>(MessageBuffer& buffer, ProxyMessageRouting& out)
+{
+    //Backward compatibility with legacy peers
+    if (buffer.GetProtocolVersion() < ProtocolVersion{3,1})
+    {
+        throw SilKit::ProtocolError{"ProxyMessage is not supported in protocol versions < 3.1"};
+    }
+    else
+    {
+        buffer
+            >> out.header
+            >> out.source
+            >> out.destination
+            ;
+    }
+    return buffer;
+}
+
+inline MessageBuffer& operator<<(MessageBuffer& buffer, const SharedMemoryMessage& msg)
+{
+    buffer
+        << msg.kind
+        << msg.segmentName
+        ;
+    return buffer;
+}
+inline MessageBuffer& operator>>(MessageBuffer& buffer, SharedMemoryMessage& out)
+{
+    buffer
+        >> out.kind
+        >> out.segmentName
+        ;
+    return buffer;
+}
+
 //////////////////////////////////////////////////////////////////////
 // Public Functions
 //////////////////////////////////////////////////////////////////////
@@ -317,6 +376,40 @@ auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader
     return header;
 }
 
+auto PeekProxyMessageRouting(MessageBuffer& buffer) -> ProxyMessageRouting
+{
+    MessageBufferPeeker peeker{buffer};
+
+    ProxyMessageRouting routing{};
+    buffer >> routing;
+    return routing;
+}
+
+auto ExtractProxyMessagePayload(MessageBuffer& buffer) -> std::vector<uint8_t>
+{
+    ProxyMessageRouting routing{};
+    uint32_t payloadSize{0};
+    buffer >> routing >> payloadSize;
+
+    const auto payloadBegin = buffer.ReadPos();
+    if (payloadBegin + payloadSize > buffer.PeekData().size())
+    {
+        throw end_of_buffer{};
+    }
+
+    auto storage = buffer.ReleaseStorage();
+    if (storage.size() < payloadBegin + payloadSize)
+    {
+        // the storage is still referenced by a deserialized view, which never happens for proxy messages
+        throw SilKitError{"ExtractProxyMessagePayload: the message storage cannot be released"};
+    }
+
+    // move the payload to the front of the received storage, instead of copying it into a new allocation
+    storage.erase(storage.begin(), storage.begin() + payloadBegin);
+    storage.resize(payloadSize);
+    return storage;
+}
+
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader
 {
     // NB: At the moment using the MessageBufferPeeker here -although correct- leads to an issue in the
@@ -389,6 +482,24 @@ void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledge& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAnnouncementBatch& out)
+{
+    buffer >> out;
+}
+
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SubscriptionAcknowledgeBatch& out)
+{
+    buffer >> out;
+}
+
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg)
 {
     buffer << msg;
@@ -407,5 +518,14 @@ void Deserialize(MessageBuffer& buffer, ProxyMessage& out)
     buffer >> out;
 }
 
+void Serialize(MessageBuffer& buffer, const SharedMemoryMessage& msg)
+{
+    buffer << msg;
+}
+void Deserialize(MessageBuffer& buffer, SharedMemoryMessage& out)
+{
+    buffer >> out;
+}
+
 } // namespace Core
 } // namespace SilKit
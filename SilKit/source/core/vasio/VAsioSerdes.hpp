@@ -42,6 +42,9 @@ auto ExtractRegistryMessageKind(MessageBuffer& buffer) -> RegistryMessageKind;
 
 auto PeekRegistryMessageHeader(MessageBuffer& buffer) -> RegistryMsgHeader;
 auto PeekProxyMessageHeader(MessageBuffer& buffer) -> ProxyMessageHeader;
+auto PeekProxyMessageRouting(MessageBuffer& buffer) -> ProxyMessageRouting;
+// Extract the payload of a ProxyMessage, the storage of the buffer is reused for it
+auto ExtractProxyMessagePayload(MessageBuffer& buffer) -> std::vector<uint8_t>;
 
 auto ExtractEndpointId(MessageBuffer& buffer) ->EndpointId;
 auto ExtractEndpointAddress(MessageBuffer& buffer) ->EndpointAddress;
@@ -52,15 +55,21 @@ void Serialize(MessageBuffer& buffer, const ParticipantAnnouncement& announcemen
 void Serialize(MessageBuffer& buffer, const ParticipantAnnouncementReply& reply);
 void Serialize(MessageBuffer& buffer, const VAsioMsgSubscriber& subscriber);
 void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledge& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAnnouncementBatch& msg);
+void Serialize(MessageBuffer& buffer, const SubscriptionAcknowledgeBatch& msg);
 void Serialize(MessageBuffer& buffer, const KnownParticipants& msg);
 void Serialize(MessageBuffer& buffer, const ProxyMessage& msg);
+void Serialize(MessageBuffer& buffer, const SharedMemoryMessage& msg);
 
 void Deserialize(MessageBuffer& buffer, ParticipantAnnouncement& out);
 void Deserialize(MessageBuffer& buffer,ParticipantAnnouncementReply& out);
 void Deserialize(MessageBuffer&, VAsioMsgSubscriber&);
 void Deserialize(MessageBuffer&, SubscriptionAcknowledge&);
+void Deserialize(MessageBuffer&, SubscriptionAnnouncementBatch&);
+void Deserialize(MessageBuffer&, SubscriptionAcknowledgeBatch&);
 void Deserialize(MessageBuffer& buffer,KnownParticipants& out);
 void Deserialize(MessageBuffer& buffer, ProxyMessage& out);
+void Deserialize(MessageBuffer& buffer, SharedMemoryMessage& out);
 
 } // namespace Core
 } // namespace SilKit
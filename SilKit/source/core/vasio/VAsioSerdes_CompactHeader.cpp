@@ -0,0 +1,84 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioSerdes_CompactHeader.hpp"
+
+#include <cstring>
+#include <limits>
+
+#include "silkit/participant/exception.hpp"
+
+namespace SilKit {
+namespace Core {
+
+auto WriteVarint(uint64_t value, uint8_t* data) -> std::size_t
+{
+    std::size_t size{0};
+    while (value >= 0x80)
+    {
+        data[size++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    data[size++] = static_cast<uint8_t>(value);
+    return size;
+}
+
+auto ReadVarint(MessageBuffer& buffer) -> uint64_t
+{
+    uint64_t value{0};
+    for (std::size_t i = 0; i < MaxVarintSize; ++i)
+    {
+        uint8_t byte{0};
+        buffer >> byte;
+        value |= static_cast<uint64_t>(byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throw end_of_buffer{};
+}
+
+auto WriteCompactSimMsgHeader(uint8_t* header, EndpointId remoteIndex, EndpointId endpointId, std::size_t payloadSize)
+    -> std::size_t
+{
+    std::size_t size = sizeof(uint32_t);
+    header[size++] = static_cast<uint8_t>(VAsioMsgKind::SilKitSimMsgCompact);
+    size += WriteVarint(remoteIndex, header + size);
+    size += WriteVarint(endpointId, header + size);
+
+    if (size + payloadSize > std::numeric_limits<uint32_t>::max())
+    {
+        throw SilKitError{"WriteCompactSimMsgHeader: message is too large"};
+    }
+    const auto messageSize = static_cast<uint32_t>(size + payloadSize);
+    std::memcpy(header, &messageSize, sizeof(uint32_t));
+    return size;
+}
+
+void ReadCompactSimMsgHeader(MessageBuffer& buffer, EndpointId& remoteIndex, EndpointId& endpointId)
+{
+    remoteIndex = ReadVarint(buffer);
+    endpointId = ReadVarint(buffer);
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,61 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "EndpointAddress.hpp"
+#include "MessageBuffer.hpp"
+#include "VAsioMsgKind.hpp"
+
+namespace SilKit {
+namespace Core {
+
+// Compact network headers of simulation messages, used with peers having the "compact-header" capability.
+//
+// Full header (29 bytes):
+//   uint32 messageSize | uint8 SilKitSimMsg | uint64 remoteIndex | uint64 participantId | uint64 endpointId
+// Compact header (7 bytes for the usual small indices):
+//   uint32 messageSize | uint8 SilKitSimMsgCompact | varint remoteIndex | varint endpointId
+//
+// The participant id is omitted, the sender of a message is always the peer it was received from. The message size
+// keeps its fixed width, it frames all message kinds on the connection.
+
+//! Maximum number of bytes of an unsigned LEB128 encoded 64-bit integer
+constexpr std::size_t MaxVarintSize = 10;
+//! Maximum number of bytes of a compact header
+constexpr std::size_t CompactSimMsgHeaderMaxSize = sizeof(uint32_t) + sizeof(VAsioMsgKind) + 2 * MaxVarintSize;
+
+//! Write the value as unsigned LEB128 and return the number of bytes written, at most MaxVarintSize
+auto WriteVarint(uint64_t value, uint8_t* data) -> std::size_t;
+//! Read an unsigned LEB128 encoded value, throws end_of_buffer if it is truncated or too long
+auto ReadVarint(MessageBuffer& buffer) -> uint64_t;
+
+//! Write the compact header of a simulation message with the given number of payload bytes, return its size
+auto WriteCompactSimMsgHeader(uint8_t* header, EndpointId remoteIndex, EndpointId endpointId, std::size_t payloadSize)
+    -> std::size_t;
+//! Read the remote index and endpoint id of a compact header, following the message size and kind
+void ReadCompactSimMsgHeader(MessageBuffer& buffer, EndpointId& remoteIndex, EndpointId& endpointId);
+
+} // namespace Core
+} // namespace SilKit
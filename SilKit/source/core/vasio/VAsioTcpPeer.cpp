@@ -20,12 +20,14 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioTcpPeer.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <thread>
 
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
+#include "VAsioCapabilities.hpp"
 #include "VAsioConnection.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
@@ -112,12 +114,48 @@ static void EnableQuickAck(SilKit::Services::Logging::ILogger* ,
 namespace SilKit {
 namespace Core {
 
+namespace {
+//! Initial size of the receive buffer, which is only grown for messages that do not fit into it
+constexpr std::size_t DefaultReceiveBufferSize = 4096;
+
+void UpdateMaximum(std::atomic<uint64_t>& maximum, uint64_t value)
+{
+    auto current = maximum.load(std::memory_order_relaxed);
+    while (current < value && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+auto SupportsCompactHeaders(const VAsioPeerInfo& peerInfo) -> bool
+{
+    return VAsioCapabilities{peerInfo.capabilities}.HasCapability("compact-header");
+}
+} // namespace
+
 // Private constructor
 VAsioTcpPeer::VAsioTcpPeer(asio::any_io_executor executor, VAsioConnection* connection, Services::Logging::ILogger* logger)
     : _socket{executor}
     , _connection{connection}
     , _logger{logger}
 {
+    const auto& middleware = _connection->Config().middleware;
+    if (middleware.batchedWriteMaxBytes > 0)
+    {
+        _batchedWriteMaxBytes = static_cast<std::size_t>(middleware.batchedWriteMaxBytes);
+        _batchedWriteMaxBuffers = static_cast<std::size_t>(std::max(middleware.batchedWriteMaxBuffers, 2));
+    }
+    _prioritizeControlMessages = middleware.prioritizeControlMessages;
+    if (middleware.enableMessageCoalescing)
+    {
+        // the messages held back during a simulation step are written with a single gathering write
+        _enableMessageCoalescing = true;
+        _messageCoalescingMaxBytes = static_cast<std::size_t>(std::max(middleware.messageCoalescingMaxBytes, 0));
+        _batchedWriteMaxBytes = std::max(_batchedWriteMaxBytes, _messageCoalescingMaxBytes);
+        _batchedWriteMaxBuffers = static_cast<std::size_t>(std::max(middleware.batchedWriteMaxBuffers, 2));
+    }
+    _sendQueueMaxBytes = static_cast<std::size_t>(std::max(middleware.sendQueueMaxBytes, 0));
+    _sendQueueMaxMessages = static_cast<std::size_t>(std::max(middleware.sendQueueMaxMessages, 0));
+    _sendQueueOverflowPolicy = middleware.sendQueueOverflowPolicy;
 }
 
 VAsioTcpPeer::~VAsioTcpPeer()
@@ -125,25 +163,37 @@ VAsioTcpPeer::~VAsioTcpPeer()
 }
 
 
-void VAsioTcpPeer::DrainAllBuffers()
+auto VAsioTcpPeer::DrainAllBuffers() -> DrainStatistics
 {
+    FlushSendBuffers();
     _isShuttingDown = true;
+    WakeBlockedSenders();
+
+    const std::size_t queuedMessages = _numQueuedMessages;
+    const std::size_t queuedBytes = _numQueuedBytes;
 
     // Wait for sendingQueue 
     int waitMs;
     for (waitMs = 100; waitMs >= 0; waitMs--)
     {
-        {
-            std::unique_lock<decltype(_sendingQueueLock)> sendingQueueLock{_sendingQueueLock};
-            if (_sendingQueue.empty())
-                break;
-        }
+        if (_numQueuedMessages == 0 && !_sharedMemorySending)
+            break;
         std::this_thread::sleep_for(1ms);
     }
+
+    DrainStatistics drainStatistics;
+    drainStatistics.numRemainingMessages = _numQueuedMessages;
+    drainStatistics.numRemainingBytes = _numQueuedBytes;
+    drainStatistics.numDrainedMessages =
+        queuedMessages - std::min<uint64_t>(queuedMessages, drainStatistics.numRemainingMessages);
+    drainStatistics.numDrainedBytes =
+        queuedBytes - std::min<uint64_t>(queuedBytes, drainStatistics.numRemainingBytes);
+
     if (waitMs <= 0)
     {
-        Services::Logging::Warn(_logger, "Could not clear sending queue to {}",
-                                GetInfo().participantName);
+        Services::Logging::Warn(_logger, "Could not clear sending queue to {}: {} messages ({} bytes) remain",
+                                GetInfo().participantName, drainStatistics.numRemainingMessages,
+                                drainStatistics.numRemainingBytes);
     }
 
     // Wait for incoming Msg 
@@ -158,6 +208,88 @@ void VAsioTcpPeer::DrainAllBuffers()
         Services::Logging::Warn(_logger, "Could not wait for read buffer on peer to {}",
                                 GetInfo().participantName);
     }
+
+    return drainStatistics;
+}
+
+void VAsioTcpPeer::FlushSendBuffers()
+{
+    if (ReleaseHeldSendingBuffers())
+    {
+        RequestWrite();
+    }
+}
+
+bool VAsioTcpPeer::HoldBackSendingBuffer(SendingBuffer sendingBuffer)
+{
+    std::lock_guard<std::mutex> lock{_heldSendingBuffersMutex};
+    _heldBytes.fetch_add(sendingBuffer.Size());
+    _heldSendingBuffers.push_back(std::move(sendingBuffer));
+    if (_heldBytes < _messageCoalescingMaxBytes)
+    {
+        return true;
+    }
+
+    MoveHeldSendingBuffersToPending();
+    return false;
+}
+
+bool VAsioTcpPeer::ReleaseHeldSendingBuffers()
+{
+    if (_heldBytes == 0)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock{_heldSendingBuffersMutex};
+    if (_heldSendingBuffers.empty())
+    {
+        return false;
+    }
+
+    MoveHeldSendingBuffersToPending();
+    return true;
+}
+
+void VAsioTcpPeer::MoveHeldSendingBuffersToPending()
+{
+    for (auto& sendingBuffer : _heldSendingBuffers)
+    {
+        _pendingSendingBuffers.Push(std::move(sendingBuffer));
+    }
+    // the vector keeps its capacity for the next simulation step
+    _heldSendingBuffers.clear();
+    _heldBytes = 0;
+}
+
+auto VAsioTcpPeer::GetWriteStatistics() const -> WriteStatistics
+{
+    WriteStatistics writeStatistics;
+    writeStatistics.numWrites = _numWrites.load(std::memory_order_relaxed);
+    writeStatistics.numWrittenBuffers = _numWrittenBuffers.load(std::memory_order_relaxed);
+    return writeStatistics;
+}
+
+auto VAsioTcpPeer::GetSendQueueStatistics() const -> SendQueueStatistics
+{
+    SendQueueStatistics sendQueueStatistics;
+    sendQueueStatistics.queuedMessages = _numQueuedMessages;
+    sendQueueStatistics.queuedBytes = _numQueuedBytes;
+    sendQueueStatistics.numDroppedMessages = _numDroppedMessages;
+    return sendQueueStatistics;
+}
+
+auto VAsioTcpPeer::GetPeerStatistics() const -> PeerStatistics
+{
+    PeerStatistics peerStatistics;
+    peerStatistics.numSentMessages = _numSentMessages.load(std::memory_order_relaxed);
+    peerStatistics.numSentBytes = _numSentBytes.load(std::memory_order_relaxed);
+    peerStatistics.numWrites = _numWrites.load(std::memory_order_relaxed);
+    peerStatistics.maxQueuedMessages = _maxQueuedMessages.load(std::memory_order_relaxed);
+    peerStatistics.maxQueuedBytes = _maxQueuedBytes.load(std::memory_order_relaxed);
+    peerStatistics.numReceivedMessages = _numReceivedMessages.load(std::memory_order_relaxed);
+    peerStatistics.numReceivedBytes = _numReceivedBytes.load(std::memory_order_relaxed);
+    return peerStatistics;
 }
 
 bool VAsioTcpPeer::IsErrorToTryAgain(const asio::error_code& ec)
@@ -176,9 +308,31 @@ void VAsioTcpPeer::Shutdown()
         SilKit::Services::Logging::Info(_logger, "Shutting down connection to {}", _info.participantName);
         _socket.close();
 
-        std::unique_lock<std::mutex> lock{_sendingQueueLock};
+        const auto writeStatistics = GetWriteStatistics();
+        if (writeStatistics.numWrites > 0)
+        {
+            SilKit::Services::Logging::Debug(
+                _logger, "Sent {} buffers in {} socket writes to {} ({:.2f} buffers per write)",
+                writeStatistics.numWrittenBuffers, writeStatistics.numWrites, _info.participantName,
+                static_cast<double>(writeStatistics.numWrittenBuffers) / writeStatistics.numWrites);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{_heldSendingBuffersMutex};
+            _heldSendingBuffers.clear();
+            _heldBytes = 0;
+        }
+        _pendingSendingBuffers.Clear();
         _sendingQueue.clear();
-        lock.unlock();
+        _sharedMemorySendingQueue.clear();
+        _numQueuedMessages = 0;
+        _numQueuedBytes = 0;
+        WakeBlockedSenders();
+        // The connection counts the full queues, this one must not hold back the senders anymore
+        if (_isAboveHighWaterMark.exchange(false))
+        {
+            NotifySendQueueHighWaterMark(false);
+        }
 
         _connection->OnPeerShutdown(this);
     }
@@ -192,6 +346,7 @@ auto VAsioTcpPeer::GetInfo() const -> const VAsioPeerInfo&
 
 void VAsioTcpPeer::SetInfo(VAsioPeerInfo peerInfo)
 {
+    _useCompactHeaders = SupportsCompactHeaders(peerInfo);
     _info = std::move(peerInfo);
 }
 
@@ -282,7 +437,6 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
         SilKit::Services::Logging::Warn(_logger, "Unable to resolve hostname \"{}:{}\"", host, port);
         return false;
     }
-    auto config = _connection->Config();
     for (auto&& resolverEntry : resolverResults)
     {
         try
@@ -298,27 +452,7 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
 
             _socket.connect(resolverEntry.endpoint());
 
-            if (config.middleware.tcpNoDelay)
-            {
-                _socket.set_option(asio::ip::tcp::no_delay{true});
-            }
-
-            if (config.middleware.tcpQuickAck)
-            {
-                _enableQuickAck = true;
-                EnableQuickAck(_logger, _socket);
-            }
-
-            if(config.middleware.tcpReceiveBufferSize > 0)
-            {
-                _socket.set_option(asio::socket_base::receive_buffer_size{config.middleware.tcpReceiveBufferSize});
-            }
-
-            if (config.middleware.tcpSendBufferSize > 0)
-            {
-                _socket.set_option(asio::socket_base::send_buffer_size{config.middleware.tcpSendBufferSize});
-            }
-
+            SetTcpSocketOptions();
 
             return true;
         }
@@ -332,8 +466,36 @@ bool VAsioTcpPeer::ConnectTcp(const std::string& host, uint16_t port)
     }
     return false;
 }
+
+void VAsioTcpPeer::SetTcpSocketOptions()
+{
+    const auto& config = _connection->Config();
+
+    if (config.middleware.tcpNoDelay)
+    {
+        _socket.set_option(asio::ip::tcp::no_delay{true});
+    }
+
+    if (config.middleware.tcpQuickAck)
+    {
+        _enableQuickAck = true;
+        EnableQuickAck(_logger, _socket);
+    }
+
+    if(config.middleware.tcpReceiveBufferSize > 0)
+    {
+        _socket.set_option(asio::socket_base::receive_buffer_size{config.middleware.tcpReceiveBufferSize});
+    }
+
+    if (config.middleware.tcpSendBufferSize > 0)
+    {
+        _socket.set_option(asio::socket_base::send_buffer_size{config.middleware.tcpSendBufferSize});
+    }
+}
+
 void VAsioTcpPeer::Connect(VAsioPeerInfo peerInfo)
 {
+    _useCompactHeaders = SupportsCompactHeaders(peerInfo);
     _info = std::move(peerInfo);
 
     std::stringstream attemptedUris;
@@ -404,29 +566,433 @@ void VAsioTcpPeer::Connect(VAsioPeerInfo peerInfo)
     }
 }
 
+struct VAsioTcpPeer::ConnectAttempt
+{
+    enum class State
+    {
+        Pending,
+        Connected,
+        Failed
+    };
+
+    struct Candidate
+    {
+        std::string uri;
+        asio::generic::stream_protocol::endpoint endpoint;
+        asio::generic::stream_protocol::socket socket;
+        bool isTcp{false};
+        State state{State::Pending};
+    };
+
+    ConnectAttempt(const asio::any_io_executor& executor, std::function<void(bool)> handler)
+        : deadlineTimer{executor}
+        , handler{std::move(handler)}
+    {
+    }
+
+    // ordered by preference
+    std::vector<Candidate> candidates;
+    asio::steady_timer deadlineTimer;
+    std::function<void(bool)> handler;
+    bool isCompleted{false};
+};
+
+void VAsioTcpPeer::ConnectAsync(VAsioPeerInfo peerInfo, std::chrono::steady_clock::time_point deadline,
+                                std::function<void(bool)> handler)
+{
+    _useCompactHeaders = SupportsCompactHeaders(peerInfo);
+    _info = std::move(peerInfo);
+
+    const auto executor = _socket.get_executor();
+    auto attempt = std::make_shared<ConnectAttempt>(executor, std::move(handler));
+
+    std::vector<Uri> uris;
+    std::transform(_info.acceptorUris.begin(), _info.acceptorUris.end(), std::back_inserter(uris),
+                   [](const auto& uriStr) {
+                       return Uri::Parse(uriStr);
+                   });
+
+    if (_connection->Config().middleware.enableDomainSockets)
+    {
+        for (const auto& uri : uris)
+        {
+            if (uri.Type() != Uri::UriType::Local)
+            {
+                continue;
+            }
+
+            try
+            {
+                asio::local::stream_protocol::endpoint endpoint{uri.Path()};
+                attempt->candidates.push_back({uri.EncodedString(), endpoint, decltype(_socket){executor}, false});
+            }
+            catch (const std::exception& error)
+            {
+                SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Invalid local-domain socket '{}': {}",
+                                                 uri.EncodedString(), error.what());
+            }
+        }
+    }
+
+    for (const auto& uri : uris)
+    {
+        if (uri.Type() != Uri::UriType::Tcp)
+        {
+            continue;
+        }
+
+        for (auto&& resolverEntry : ResolveHostAndPort(executor, _logger, uri.Host(), uri.Port()))
+        {
+            attempt->candidates.push_back(
+                {uri.EncodedString(), resolverEntry.endpoint(), decltype(_socket){executor}, true});
+        }
+    }
+
+    attempt->deadlineTimer.expires_at(deadline);
+
+    // the completion handlers of the connects run on the strand of this peer
+    asio::dispatch(executor, [self = shared_from_this(), attempt] {
+        self->StartConnectAttempt(attempt);
+    });
+}
+
+void VAsioTcpPeer::StartConnectAttempt(const std::shared_ptr<ConnectAttempt>& attempt)
+{
+    for (std::size_t index = 0; index < attempt->candidates.size(); ++index)
+    {
+        auto& candidate = attempt->candidates[index];
+
+        try
+        {
+            candidate.socket.open(candidate.endpoint.protocol());
+            if (candidate.isTcp)
+            {
+                SetConnectOptions(_logger, candidate.socket);
+            }
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Unable to open a socket for '{}': {}",
+                                             candidate.uri, error.what());
+            candidate.state = ConnectAttempt::State::Failed;
+            continue;
+        }
+
+        SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Connecting to '{}'", candidate.uri);
+
+        candidate.socket.async_connect(
+            candidate.endpoint, [self = shared_from_this(), attempt, index](const asio::error_code& errorCode) {
+                auto& candidate = attempt->candidates[index];
+                if (candidate.state == ConnectAttempt::State::Pending)
+                {
+                    candidate.state = errorCode ? ConnectAttempt::State::Failed : ConnectAttempt::State::Connected;
+                }
+                if (errorCode)
+                {
+                    SilKit::Services::Logging::Debug(self->_logger, "ConnectAsync: Error while connecting to '{}': {}",
+                                                     candidate.uri, errorCode.message());
+                }
+                self->CompleteConnectAttempt(attempt);
+            });
+    }
+
+    attempt->deadlineTimer.async_wait([self = shared_from_this(), attempt](const asio::error_code& errorCode) {
+        if (errorCode == asio::error::operation_aborted)
+        {
+            return;
+        }
+        for (auto& candidate : attempt->candidates)
+        {
+            if (candidate.state == ConnectAttempt::State::Pending)
+            {
+                SilKit::Services::Logging::Debug(self->_logger, "ConnectAsync: Connecting to '{}' timed out",
+                                                 candidate.uri);
+                candidate.state = ConnectAttempt::State::Failed;
+                asio::error_code ignored;
+                candidate.socket.close(ignored);
+            }
+        }
+        self->CompleteConnectAttempt(attempt);
+    });
+
+    // completes immediately, if no connect could be started
+    CompleteConnectAttempt(attempt);
+}
+
+void VAsioTcpPeer::CompleteConnectAttempt(const std::shared_ptr<ConnectAttempt>& attempt)
+{
+    if (attempt->isCompleted)
+    {
+        return;
+    }
+
+    ConnectAttempt::Candidate* connected{nullptr};
+    for (auto& candidate : attempt->candidates)
+    {
+        if (candidate.state == ConnectAttempt::State::Pending)
+        {
+            // a more preferred URI may still be connected
+            return;
+        }
+        if (candidate.state == ConnectAttempt::State::Connected)
+        {
+            connected = &candidate;
+            break;
+        }
+    }
+
+    attempt->isCompleted = true;
+    attempt->deadlineTimer.cancel();
+
+    if (connected != nullptr)
+    {
+        SilKit::Services::Logging::Debug(_logger, "ConnectAsync: Connected to '{}'", connected->uri);
+
+        _socket = std::move(connected->socket);
+        if (connected->isTcp)
+        {
+            try
+            {
+                SetTcpSocketOptions();
+            }
+            catch (const std::exception& error)
+            {
+                SilKit::Services::Logging::Warn(_logger, "ConnectAsync: Unable to set the socket options of '{}': {}",
+                                                connected->uri, error.what());
+            }
+        }
+    }
+
+    // abandon the connects to the less preferred URIs
+    for (auto& candidate : attempt->candidates)
+    {
+        asio::error_code ignored;
+        candidate.socket.close(ignored);
+    }
+
+    attempt->handler(connected != nullptr);
+}
+
 void VAsioTcpPeer::SendSilKitMsg(SerializedMessage buffer)
 {
     // Prevent sending when shutting down
     if (!_isShuttingDown && _socket.is_open())
     {
-        std::unique_lock<std::mutex> lock{_sendingQueueLock};
+        // Only the messages of services are limited, the handshake, time synchronization and lifecycle must proceed
+        const auto isBounded = (_sendQueueMaxBytes > 0 || _sendQueueMaxMessages > 0)
+                               && IsMwOrSim(buffer.GetMessageKind()) && !buffer.IsControlMsg();
+        if (isBounded && IsSendQueueFull() && !HandleSendQueueOverflow())
+        {
+            return;
+        }
+
+        // Service messages are held back until the end of the simulation step, or until enough are queued
+        auto holdBack = _enableMessageCoalescing && IsMwOrSim(buffer.GetMessageKind())
+                        && _connection->IsBufferingSends();
+
+        SendingBuffer sendingBuffer;
+        if (_useCompactHeaders && buffer.GetMessageKind() == VAsioMsgKind::SilKitSimMsg)
+        {
+            // the full network headers at the beginning of the storage are replaced by the compact headers
+            const auto remoteIndex = buffer.GetRemoteIndex();
+            const auto endpointId = buffer.GetEndpointAddress().endpoint;
+            if (buffer.HasSharedStorage())
+            {
+                sendingBuffer.sharedData = buffer.GetSharedStorage();
+            }
+            else
+            {
+                sendingBuffer.data = buffer.ReleaseStorage();
+            }
+            sendingBuffer.dataOffset = SerializedMessage::SimMsgHeaderSize;
+            sendingBuffer.headerSize =
+                WriteCompactSimMsgHeader(sendingBuffer.header.data(), remoteIndex, endpointId,
+                                         sendingBuffer.Storage().size() - SerializedMessage::SimMsgHeaderSize);
+        }
+        else if (buffer.HasSharedStorage())
+        {
+            const auto& sharedHeader = buffer.GetSharedHeader();
+            std::copy(sharedHeader.begin(), sharedHeader.end(), sendingBuffer.header.begin());
+            sendingBuffer.headerSize = sharedHeader.size();
+            sendingBuffer.dataOffset = SerializedMessage::SharedHeaderSize;
+            sendingBuffer.sharedData = buffer.GetSharedStorage();
+        }
+        else
+        {
+            sendingBuffer.data = buffer.ReleaseStorage();
+        }
+        sendingBuffer.isControlMsg = _prioritizeControlMessages && buffer.IsControlMsg();
+        sendingBuffer.isDroppable = buffer.IsDroppableMsg();
+
+        const auto messageSize = sendingBuffer.Size();
+        UpdateMaximum(_maxQueuedMessages, _numQueuedMessages.fetch_add(1) + 1);
+        UpdateMaximum(_maxQueuedBytes, _numQueuedBytes.fetch_add(messageSize) + messageSize);
+
+        if (isBounded && IsSendQueueFull())
+        {
+            if (!_isAboveHighWaterMark.exchange(true))
+            {
+                NotifySendQueueHighWaterMark(true);
+            }
+            // the held back messages are written right away, otherwise the queue cannot drain
+            holdBack = false;
+        }
+
+        if (holdBack)
+        {
+            if (HoldBackSendingBuffer(std::move(sendingBuffer)))
+            {
+                return;
+            }
+        }
+        else
+        {
+            // the held back messages were sent first, they must be written first
+            ReleaseHeldSendingBuffers();
+            _pendingSendingBuffers.Push(std::move(sendingBuffer));
+        }
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        RequestWrite();
+    }
+}
 
-        lock.unlock();
+bool VAsioTcpPeer::IsSendQueueFull() const
+{
+    return (_sendQueueMaxBytes > 0 && _numQueuedBytes >= _sendQueueMaxBytes)
+           || (_sendQueueMaxMessages > 0 && _numQueuedMessages >= _sendQueueMaxMessages);
+}
+
+bool VAsioTcpPeer::HandleSendQueueOverflow()
+{
+    using Policy = Config::Middleware::SendQueueOverflowPolicy;
 
+    // The IO threads run the handlers of received messages. They must never wait for the queue, which only they drain.
+    if (_sendQueueOverflowPolicy == Policy::DropOldest || _connection->IsIoWorkerThread())
+    {
+        return true;
+    }
+
+    if (_sendQueueOverflowPolicy == Policy::Error)
+    {
+        throw SilKitError{fmt::format("The sending queue to participant '{}' is full: {} messages ({} bytes) queued",
+                                      _info.participantName, _numQueuedMessages.load(), _numQueuedBytes.load())};
+    }
+
+    // the held back messages must be written, for the queue to drain
+    ReleaseHeldSendingBuffers();
+    RequestWrite();
+
+    std::unique_lock<std::mutex> lock{_sendQueueMutex};
+    ++_numBlockedSenders;
+    _sendQueueSpaceAvailable.wait(lock, [this] {
+        return !IsSendQueueFull() || _isShuttingDown || !_socket.is_open();
+    });
+    --_numBlockedSenders;
+
+    return !_isShuttingDown && _socket.is_open();
+}
+
+void VAsioTcpPeer::DropOldestSendingBuffers(SendingQueue& queue)
+{
+    // Drop the oldest droppable messages until the queue is within its limits again, never those already being written
+    auto isAboveLimits = [this] {
+        return (_sendQueueMaxBytes > 0 && _numQueuedBytes > _sendQueueMaxBytes)
+               || (_sendQueueMaxMessages > 0 && _numQueuedMessages > _sendQueueMaxMessages);
+    };
+
+    auto& bulk = queue.bulk;
+    auto it = std::remove_if(bulk.begin(), bulk.end(), [this, &isAboveLimits](const SendingBuffer& sendingBuffer) {
+        if (!sendingBuffer.isDroppable || !isAboveLimits())
+        {
+            return false;
+        }
+        _numQueuedMessages.fetch_sub(1);
+        _numQueuedBytes.fetch_sub(sendingBuffer.Size());
+        _numDroppedMessages.fetch_add(1);
+        return true;
+    });
+    bulk.erase(it, bulk.end());
+}
+
+void VAsioTcpPeer::OnSendQueueDrained(std::size_t numMessages, std::size_t numBytes)
+{
+    _numQueuedMessages.fetch_sub(numMessages);
+    _numQueuedBytes.fetch_sub(numBytes);
+    _numSentMessages.fetch_add(numMessages, std::memory_order_relaxed);
+    _numSentBytes.fetch_add(numBytes, std::memory_order_relaxed);
+
+    if (_numBlockedSenders > 0)
+    {
+        WakeBlockedSenders();
+    }
+
+    // Notify once the queue drained to half of its limits, to not notify again for every further message
+    if (_isAboveHighWaterMark && (_sendQueueMaxBytes == 0 || _numQueuedBytes <= _sendQueueMaxBytes / 2)
+        && (_sendQueueMaxMessages == 0 || _numQueuedMessages <= _sendQueueMaxMessages / 2)
+        && _isAboveHighWaterMark.exchange(false))
+    {
+        NotifySendQueueHighWaterMark(false);
+    }
+}
+
+void VAsioTcpPeer::WakeBlockedSenders()
+{
+    // Locking the mutex ensures that a sender which just found the queue full is already waiting
+    {
+        std::lock_guard<std::mutex> lock{_sendQueueMutex};
+    }
+    _sendQueueSpaceAvailable.notify_all();
+}
+
+void VAsioTcpPeer::NotifySendQueueHighWaterMark(bool isAboveHighWaterMark)
+{
+    SilKit::Experimental::Participant::SendQueueHighWaterMarkEvent event;
+    event.participantName = _info.participantName;
+    event.isAboveHighWaterMark = isAboveHighWaterMark;
+    event.queuedMessages = _numQueuedMessages;
+    event.queuedBytes = _numQueuedBytes;
+    event.numDroppedMessages = _numDroppedMessages;
+    _connection->OnSendQueueHighWaterMark(event);
+}
+
+void VAsioTcpPeer::RequestWrite()
+{
+    // A single request is outstanding at a time, it picks up all messages pushed until it runs on the IO thread
+    if (!_writeRequested.exchange(true))
+    {
         asio::dispatch(_socket.get_executor(), [this]() {
-            StartAsyncWrite();
+            _writeRequested = false;
+            StartWrites();
         });
     }
 }
 
+void VAsioTcpPeer::StartWrites()
+{
+    TakePendingSendingBuffers();
+    StartAsyncWrite();
+    StartSharedMemoryWrite();
+}
+
+void VAsioTcpPeer::TakePendingSendingBuffers()
+{
+    // _sharedMemoryActive is only changed on the IO thread, so the messages stay in order across the switch
+    auto& queue = _sharedMemoryActive ? _sharedMemorySendingQueue : _sendingQueue;
+    _pendingSendingBuffers.PopAll([&queue](SendingBuffer sendingBuffer) {
+        queue.push_back(std::move(sendingBuffer));
+    });
+
+    if (_sendQueueOverflowPolicy == Config::Middleware::SendQueueOverflowPolicy::DropOldest)
+    {
+        DropOldestSendingBuffers(queue);
+    }
+}
+
 void VAsioTcpPeer::StartAsyncWrite()
 {
     if (_sending)
         return;
 
-    std::unique_lock<std::mutex> lock{ _sendingQueueLock };
     if (_sendingQueue.empty())
     {
         return;
@@ -434,17 +1000,75 @@ void VAsioTcpPeer::StartAsyncWrite()
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
-    lock.unlock();
+    const auto batchBytes = TakeSendingBatch(_sendingQueue, _currentSendingBufferData);
+    OnSendQueueDrained(_currentSendingBufferData.size(), batchBytes);
+
+    MakeSendingBuffers(_currentSendingBufferData, _currentSendingBuffers);
+    _numWrittenBuffers.fetch_add(_currentSendingBufferData.size(), std::memory_order_relaxed);
 
-    _currentSendingBuffer = asio::buffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
     WriteSomeAsync();
 }
 
+auto VAsioTcpPeer::TakeSendingBatch(SendingQueue& queue, std::vector<SendingBuffer>& batch) const -> std::size_t
+{
+    // Take as many queued messages as allowed by the batching limits, but at least one
+    batch.clear();
+    std::size_t batchBytes{0};
+    std::size_t batchBuffers{0};
+    do
+    {
+        auto& sendingBuffer = queue.front();
+        const auto size = sendingBuffer.Size();
+        batchBuffers += sendingBuffer.NumBuffers();
+        if (!batch.empty() && (batchBytes + size > _batchedWriteMaxBytes || batchBuffers > _batchedWriteMaxBuffers))
+        {
+            break;
+        }
+
+        batchBytes += size;
+        batch.push_back(std::move(sendingBuffer));
+        queue.pop_front();
+    } while (!queue.empty());
+
+    return batchBytes;
+}
+
+void VAsioTcpPeer::MakeSendingBuffers(const std::vector<SendingBuffer>& batch,
+                                      std::vector<asio::const_buffer>& buffers)
+{
+    // The asio buffers must only be created after the batch is complete, because they refer into its elements
+    buffers.clear();
+    for (const auto& sendingBuffer : batch)
+    {
+        // the separately written headers replace the beginning of the storage
+        const auto& storage = sendingBuffer.Storage();
+        if (sendingBuffer.headerSize > 0)
+        {
+            buffers.push_back(asio::buffer(sendingBuffer.header.data(), sendingBuffer.headerSize));
+        }
+        buffers.push_back(
+            asio::buffer(storage.data() + sendingBuffer.dataOffset, storage.size() - sendingBuffer.dataOffset));
+    }
+}
+
+void VAsioTcpPeer::ConsumeSendingBuffers(std::vector<asio::const_buffer>& buffers, std::size_t bytesWritten)
+{
+    auto it = buffers.begin();
+    for (; it != buffers.end() && bytesWritten >= it->size(); ++it)
+    {
+        bytesWritten -= it->size();
+    }
+    if (it != buffers.end())
+    {
+        *it += bytesWritten;
+    }
+    buffers.erase(buffers.begin(), it);
+}
+
 void VAsioTcpPeer::WriteSomeAsync()
 {
-    _socket.async_write_some(_currentSendingBuffer,
+    _numWrites.fetch_add(1, std::memory_order_relaxed);
+    _socket.async_write_some(_currentSendingBuffers,
         [self=this->shared_from_this()](const asio::error_code& error, std::size_t bytesWritten) {
             if (error && !IsErrorToTryAgain(error))
             {
@@ -453,15 +1077,15 @@ void VAsioTcpPeer::WriteSomeAsync()
                 return;
             }
 
-            if (bytesWritten < self->_currentSendingBuffer.size())
+            ConsumeSendingBuffers(self->_currentSendingBuffers, bytesWritten);
+            if (!self->_currentSendingBuffers.empty())
             {
-                self->_currentSendingBuffer += bytesWritten;
                 self->WriteSomeAsync();
                 return;
             }
 
             self->_sending = false;
-            self->StartAsyncWrite();
+            self->StartWrites();
         }
     );
 }
@@ -474,17 +1098,21 @@ void VAsioTcpPeer::Subscribe(VAsioMsgSubscriber subscriber)
 
 void VAsioTcpPeer::StartAsyncRead()
 {
-    _currentMsgSize = 0u;
+    // all operations on the socket happen on its executor, which is a strand if multiple IO worker threads are used
+    asio::dispatch(_socket.get_executor(), [self = this->shared_from_this()]() {
+        self->_currentMsgSize = 0u;
 
-    _msgBuffer.resize(4096);
-    _wPos = {0u};
+        self->_msgBuffer = self->_receiveBufferPool.Acquire(DefaultReceiveBufferSize);
+        self->_wPos = {0u};
+        self->_rPos = {0u};
 
-    ReadSomeAsync();
+        self->ReadSomeAsync();
+    });
 }
 
 void VAsioTcpPeer::ReadSomeAsync()
 {
-    SILKIT_ASSERT(_msgBuffer.size() > 0);
+    SILKIT_ASSERT(_msgBuffer.size() > _wPos);
     auto* wPtr = _msgBuffer.data() + _wPos;
     auto  size = _msgBuffer.size() - _wPos;
 
@@ -511,68 +1139,394 @@ void VAsioTcpPeer::ReadSomeAsync()
 
 void VAsioTcpPeer::DispatchBuffer()
 {
-    if (_currentMsgSize == 0)
+    // Dispatch all complete messages contained in the receive buffer
+    while (true)
     {
-        if (_isShuttingDown)
+        const auto bytesAvailable = _wPos - _rPos;
+        if (_currentMsgSize == 0)
+        {
+            if (_isShuttingDown)
+            {
+                return;
+            }
+            if (bytesAvailable < sizeof(uint32_t))
+            {
+                // not enough data to even determine the message size...
+                break;
+            }
+
+            uint32_t msgSize{0u};
+            memcpy(&msgSize, _msgBuffer.data() + _rPos, sizeof msgSize);
+            _currentMsgSize = msgSize;
+        }
+
+        if (!IsValidMessageSize(_currentMsgSize))
         {
             return;
         }
-        if (_wPos >= sizeof(uint32_t))
+
+        if (bytesAvailable < _currentMsgSize)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            // wait until we have more data
+            break;
+        }
+
+        // The message is not parsed in place: receivers and relays may keep its storage beyond the dispatch, while
+        // the receive buffer is refilled by the next read.
+        std::vector<uint8_t> messageData;
+        if (_rPos == 0 && bytesAvailable == _currentMsgSize && _msgBuffer.size() > DefaultReceiveBufferSize)
+        {
+            // The receive buffer was grown for this message only, hand it over instead of copying the large message
+            _msgBuffer.resize(_currentMsgSize);
+            messageData = std::move(_msgBuffer);
+            _msgBuffer = _receiveBufferPool.Acquire(DefaultReceiveBufferSize);
+            _wPos = 0u;
         }
         else
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096); 
-            // and restart the async read operation
-            ReadSomeAsync();
-            return;
+            // The message storage is recycled from the pool, so that only the bytes of small messages are copied
+            messageData = _receiveBufferPool.Acquire(_currentMsgSize);
+            memcpy(messageData.data(), _msgBuffer.data() + _rPos, _currentMsgSize);
+            _rPos += _currentMsgSize;
+        }
+
+        DispatchMessage(std::move(messageData));
+        _currentMsgSize = 0u;
+    }
+
+    PrepareReceiveBuffer();
+    ReadSomeAsync();
+}
+
+void VAsioTcpPeer::DispatchMessage(std::vector<uint8_t> messageData)
+{
+    const auto messageSize = messageData.size();
+    SerializedMessage message{std::move(messageData)};
+    message.SetProtocolVersion(GetProtocolVersion());
+    if (message.GetMessageKind() == VAsioMsgKind::SilKitSharedMemoryMessage)
+    {
+        // the transport messages are handled by the peer itself
+        OnSharedMemoryMessage(message.Deserialize<SharedMemoryMessage>());
+    }
+    else
+    {
+        if (message.GetMessageKind() == VAsioMsgKind::SilKitSimMsg)
+        {
+            // payloads referencing the storage, e.g., Ethernet frames, keep a recycled holder alive
+            message.SetSharedStorageHolder(_receiveBufferPool.AcquireSharedStorageHolder());
         }
+        _connection->OnSocketData(this, std::move(message));
+        _numReceivedMessages.fetch_add(1, std::memory_order_relaxed);
+        _numReceivedBytes.fetch_add(messageSize, std::memory_order_relaxed);
     }
 
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
+    // The storage is still owned by the message, unless a receiver has taken it over
+    _receiveBufferPool.Release(message.ReleaseReceivedStorage());
+}
+
+bool VAsioTcpPeer::IsValidMessageSize(uint32_t messageSize)
+{
+    if (messageSize < sizeof(uint32_t) || messageSize > 1024 * 1024 * 1024)
     {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
+        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", messageSize);
         Shutdown();
+        return false;
+    }
+    return true;
+}
+
+void VAsioTcpPeer::PrepareReceiveBuffer()
+{
+    // keep trailing data of an incomplete message at the beginning of the buffer
+    const auto bytesAvailable = _wPos - _rPos;
+    if (_rPos > 0)
+    {
+        memmove(_msgBuffer.data(), _msgBuffer.data() + _rPos, bytesAvailable);
+        _rPos = 0u;
+        _wPos = bytesAvailable;
+    }
+
+    // Make the buffer large enough to contain the incomplete message. Buffers grown for very large messages are
+    // returned to the pool (which frees them), once they are not needed anymore.
+    const std::size_t requiredSize = std::max<std::size_t>(_currentMsgSize, DefaultReceiveBufferSize);
+    if (_msgBuffer.size() < requiredSize
+        || (_msgBuffer.size() > DefaultReceiveBufferSize && _msgBuffer.size() > 2 * requiredSize))
+    {
+        auto newBuffer = _receiveBufferPool.Acquire(requiredSize);
+        memcpy(newBuffer.data(), _msgBuffer.data(), _wPos);
+        _receiveBufferPool.Release(std::move(_msgBuffer));
+        _msgBuffer = std::move(newBuffer);
+    }
+}
+
+auto VAsioTcpPeer::GetReceiveStatistics() const -> ReceiveStatistics
+{
+    ReceiveStatistics receiveStatistics;
+    receiveStatistics.numReceivedMessages = _numReceivedMessages.load(std::memory_order_relaxed);
+    receiveStatistics.numAllocations = _receiveBufferPool.GetStatistics().numAllocations;
+    return receiveStatistics;
+}
+
+// ================================================================================
+//  Shared Memory Transport
+// ================================================================================
+
+void VAsioTcpPeer::OfferSharedMemory()
+{
+    asio::dispatch(_socket.get_executor(), [self = this->shared_from_this()]() {
+        if (!self->_socket.is_open() || self->_sharedMemoryChannel)
+        {
+            return;
+        }
+
+        // both peers must run on the same host, which is guaranteed for local domain sockets
+        asio::error_code error;
+        const auto localEndpoint = self->_socket.local_endpoint(error);
+        if (error || localEndpoint.protocol().family() != asio::local::stream_protocol{}.family())
+        {
+            return;
+        }
+
+        try
+        {
+            self->_sharedMemoryChannel = SharedMemoryChannel::Create();
+        }
+        catch (const SilKitError& err)
+        {
+            SilKit::Services::Logging::Warn(self->_logger, "Cannot use shared memory for the connection to {}: {}",
+                                            self->_info.participantName, err.what());
+            return;
+        }
+
+        SilKit::Services::Logging::Debug(self->_logger, "Offering shared memory segment '{}' to {}",
+                                         self->_sharedMemoryChannel->GetName(), self->_info.participantName);
+        self->SendSharedMemoryMessage(SharedMemoryMessageKind::Announcement, self->_sharedMemoryChannel->GetName());
+    });
+}
+
+auto VAsioTcpPeer::IsUsingSharedMemory() const -> bool
+{
+    return _sharedMemoryActive;
+}
+
+void VAsioTcpPeer::SendSharedMemoryMessage(SharedMemoryMessageKind kind, std::string segmentName)
+{
+    if (!_socket.is_open())
+    {
+        return;
     }
 
+    SharedMemoryMessage message;
+    message.kind = kind;
+    message.segmentName = std::move(segmentName);
+
+    SendingBuffer sendingBuffer;
+    sendingBuffer.data = SerializedMessage{message}.ReleaseStorage();
 
-    if (_wPos < _currentMsgSize)
+    _numQueuedMessages.fetch_add(1);
+    _numQueuedBytes.fetch_add(sendingBuffer.Size());
+    _sendingQueue.push_back(std::move(sendingBuffer));
+    if (kind == SharedMemoryMessageKind::Accepted)
     {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
+        // all messages sent after the acceptance are written to the shared memory, the remote peer reads them only
+        // after it received the acceptance
+        _sharedMemoryActive = true;
+    }
+
+    StartAsyncWrite();
+}
+
+void VAsioTcpPeer::OnSharedMemoryMessage(const SharedMemoryMessage& message)
+{
+    switch (message.kind)
+    {
+    case SharedMemoryMessageKind::Announcement:
+        AcceptSharedMemory(message.segmentName);
+        break;
+    case SharedMemoryMessageKind::Accepted:
+        if (_sharedMemoryChannel)
+        {
+            // the remote peer mapped the segment, its name is not required anymore
+            _sharedMemoryChannel->Unlink();
+            _sharedMemoryActive = true;
+            SilKit::Services::Logging::Debug(_logger, "Using shared memory for the connection to {}",
+                                             _info.participantName);
+        }
+        break;
+    case SharedMemoryMessageKind::Rejected:
+        SilKit::Services::Logging::Debug(_logger, "{} rejected using shared memory, the socket is used instead",
+                                         _info.participantName);
+        _sharedMemoryChannel.reset();
+        break;
+    case SharedMemoryMessageKind::DataAvailable:
+        if (_sharedMemoryChannel)
+        {
+            ReadSharedMemory();
+        }
+        break;
+    case SharedMemoryMessageKind::SpaceAvailable:
+        if (_sharedMemoryChannel && _sharedMemorySending)
+        {
+            WriteSharedMemory();
+            StartSharedMemoryWrite();
+        }
+        break;
+    default:
+        SilKit::Services::Logging::Warn(_logger, "Received unknown shared memory message from {}",
+                                        _info.participantName);
+        break;
+    }
+}
+
+void VAsioTcpPeer::AcceptSharedMemory(const std::string& segmentName)
+{
+    if (!_connection->Config().middleware.enableSharedMemory || _sharedMemoryChannel)
+    {
+        SendSharedMemoryMessage(SharedMemoryMessageKind::Rejected);
         return;
     }
-    else
+
+    try
     {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
+        _sharedMemoryChannel = SharedMemoryChannel::Open(segmentName);
+    }
+    catch (const SilKitError& err)
+    {
+        SilKit::Services::Logging::Warn(_logger, "Cannot use shared memory for the connection to {}: {}",
+                                        _info.participantName, err.what());
+        SendSharedMemoryMessage(SharedMemoryMessageKind::Rejected);
+        return;
+    }
+
+    SilKit::Services::Logging::Debug(_logger, "Using shared memory for the connection to {}", _info.participantName);
+    SendSharedMemoryMessage(SharedMemoryMessageKind::Accepted);
+}
+
+void VAsioTcpPeer::StartSharedMemoryWrite()
+{
+    while (!_sharedMemorySending)
+    {
+        if (_sharedMemoryActive)
+        {
+            TakePendingSendingBuffers();
+        }
+        if (_sharedMemorySendingQueue.empty())
+        {
+            return;
+        }
+
+        _sharedMemorySending = true;
+
+        const auto batchBytes = TakeSendingBatch(_sharedMemorySendingQueue, _currentSharedMemoryBufferData);
+        OnSendQueueDrained(_currentSharedMemoryBufferData.size(), batchBytes);
+
+        MakeSendingBuffers(_currentSharedMemoryBufferData, _currentSharedMemoryBuffers);
+
+        WriteSharedMemory();
+    }
+}
+
+void VAsioTcpPeer::WriteSharedMemory()
+{
+    auto& ring = _sharedMemoryChannel->SendRing();
+    while (true)
+    {
+        std::size_t bytesWritten{0};
+        for (const auto& buffer : _currentSharedMemoryBuffers)
+        {
+            const auto count = ring.Write(buffer.data(), buffer.size());
+            bytesWritten += count;
+            if (count < buffer.size())
+            {
+                break;
+            }
+        }
+        ConsumeSendingBuffers(_currentSharedMemoryBuffers, bytesWritten);
+
+        if (bytesWritten > 0 && ring.WakeReader())
+        {
+            SendSharedMemoryMessage(SharedMemoryMessageKind::DataAvailable);
+        }
+
+        if (_currentSharedMemoryBuffers.empty())
+        {
+            break;
+        }
+
+        // the ring is full, writing is continued once the remote peer signals SpaceAvailable
+        if (ring.SuspendWriter())
+        {
+            return;
+        }
+    }
+
+    _currentSharedMemoryBufferData.clear();
+    _sharedMemorySending = false;
+}
+
+void VAsioTcpPeer::ReadSharedMemory()
+{
+    auto& ring = _sharedMemoryChannel->ReceiveRing();
+    do
+    {
+        while (ReadSharedMemoryMessage())
+        {
+        }
+
+        if (_isShuttingDown || !_socket.is_open())
+        {
+            return;
+        }
+
+        if (ring.WakeWriter())
+        {
+            SendSharedMemoryMessage(SharedMemoryMessageKind::SpaceAvailable);
+        }
+    } while (!ring.SuspendReader());
+}
+
+bool VAsioTcpPeer::ReadSharedMemoryMessage()
+{
+    auto& ring = _sharedMemoryChannel->ReceiveRing();
+    if (_sharedMemoryMsgSize == 0)
+    {
+        if (_isShuttingDown)
+        {
+            return false;
+        }
+
+        // the message size might be split across two writes of the remote peer
+        _sharedMemoryMsgPos += ring.Read(_sharedMemoryMsgHeader.data() + _sharedMemoryMsgPos,
+                                         _sharedMemoryMsgHeader.size() - _sharedMemoryMsgPos);
+        if (_sharedMemoryMsgPos < _sharedMemoryMsgHeader.size())
+        {
+            return false;
+        }
 
-        // manually extract the message size so we can adjust the MessageBuffer size
         uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
+        memcpy(&msgSize, _sharedMemoryMsgHeader.data(), sizeof msgSize);
+        if (!IsValidMessageSize(msgSize))
         {
-            throw SilKitError{ "DispatchBuffer: Received message is too small to contain message size header" };
+            return false;
         }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
-        message.SetProtocolVersion(GetProtocolVersion());
-        _connection->OnSocketData(this, std::move(message));
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+        // the message is copied from the ring directly into its storage
+        _sharedMemoryMsgSize = msgSize;
+        _sharedMemoryMsgBuffer = _receiveBufferPool.Acquire(msgSize);
+        memcpy(_sharedMemoryMsgBuffer.data(), _sharedMemoryMsgHeader.data(), _sharedMemoryMsgHeader.size());
+    }
 
-        DispatchBuffer();
+    _sharedMemoryMsgPos += ring.Read(_sharedMemoryMsgBuffer.data() + _sharedMemoryMsgPos,
+                                     _sharedMemoryMsgSize - _sharedMemoryMsgPos);
+    if (_sharedMemoryMsgPos < _sharedMemoryMsgSize)
+    {
+        return false;
     }
+
+    _sharedMemoryMsgSize = 0u;
+    _sharedMemoryMsgPos = 0u;
+    DispatchMessage(std::move(_sharedMemoryMsgBuffer));
+    return true;
 }
 
 } // namespace Core
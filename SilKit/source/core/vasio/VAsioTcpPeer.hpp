@@ -22,8 +22,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 
+#include <array>
 #include <vector>
 #include <queue>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <mutex>
 
 #include "asio.hpp"
@@ -31,10 +37,16 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/logging/ILogger.hpp"
 
 #include "EndpointAddress.hpp"
+#include "ParticipantConfiguration.hpp"
 #include "MessageBuffer.hpp"
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp"
 #include "IVAsioConnectionPeer.hpp"
+#include "SerializedMessage.hpp"
+#include "ReceiveBufferPool.hpp"
+#include "SharedMemoryChannel.hpp"
+#include "MpscQueue.hpp"
+#include "RemoteServiceEndpoint.hpp"
 
 
 namespace SilKit {
@@ -50,6 +62,28 @@ public:
     // ----------------------------------------
     // Public Data Types
 
+    //! Counters of the socket writes, e.g., to verify the effect of batched writes.
+    struct WriteStatistics
+    {
+        uint64_t numWrites{0}; //!< Number of socket write operations
+        uint64_t numWrittenBuffers{0}; //!< Number of queued messages written to the socket
+    };
+
+    //! Counters of the receive path, e.g., to verify that receiving messages does not allocate.
+    struct ReceiveStatistics
+    {
+        uint64_t numReceivedMessages{0}; //!< Number of messages dispatched to the connection
+        uint64_t numAllocations{0}; //!< Number of receive buffers that required a heap allocation
+    };
+
+    //! The current size of the sending queue, see the Middleware fields SendQueueMaxBytes and SendQueueMaxMessages.
+    struct SendQueueStatistics
+    {
+        uint64_t queuedMessages{0}; //!< Number of messages waiting to be written
+        uint64_t queuedBytes{0}; //!< Number of bytes waiting to be written
+        uint64_t numDroppedMessages{0}; //!< Number of messages dropped by the DropOldest overflow policy
+    };
+
 public:
     // ----------------------------------------
     // Constructors and Destructor
@@ -91,6 +125,15 @@ public:
     auto GetLocalAddress() const -> std::string override;
 
     void Connect(VAsioPeerInfo info);
+    //! Connect to all acceptor URIs of the remote peer concurrently. The connection is chosen in the same order of
+    //! preference as in Connect, local-domain sockets before TCP. The handler is called on the strand of this peer,
+    //! with false, if no URI was connected before the deadline.
+    void ConnectAsync(VAsioPeerInfo info, std::chrono::steady_clock::time_point deadline,
+                      std::function<void(bool)> handler);
+    //! Offer the remote peer to exchange messages via shared memory. Only has an effect on local domain sockets.
+    //! The socket is kept for the handshake of the transport and for waking up the remote peer.
+    void OfferSharedMemory();
+    auto IsUsingSharedMemory() const -> bool;
 
     inline auto Socket() -> asio::generic::stream_protocol::socket& { return _socket; }
 
@@ -100,22 +143,119 @@ public:
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
     inline auto GetServiceDescriptor() const -> const Core::ServiceDescriptor & override;
 
+    inline auto GetRemoteServiceEndpoint(EndpointId endpointId)
+        -> std::shared_ptr<const RemoteServiceEndpoint> override;
+
     inline void SetProtocolVersion(ProtocolVersion v)  override;
     inline auto GetProtocolVersion() const -> ProtocolVersion  override;
     
-    void DrainAllBuffers() override;
+    auto DrainAllBuffers() -> DrainStatistics override;
+    auto GetPeerStatistics() const -> PeerStatistics override;
+    void FlushSendBuffers() override;
+
+    auto GetWriteStatistics() const -> WriteStatistics;
+    auto GetReceiveStatistics() const -> ReceiveStatistics;
+    auto GetSendQueueStatistics() const -> SendQueueStatistics;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+
+    //! Largest network headers written separately from the storage of a queued message
+    static constexpr std::size_t MaxSendingHeaderSize = CompactSimMsgHeaderMaxSize;
+    static_assert(MaxSendingHeaderSize >= SerializedMessage::SharedHeaderSize, "the shared header must fit");
+
+    //! A queued message: its owned or shared storage, optionally preceded by separately written network headers.
+    struct SendingBuffer
+    {
+        std::vector<uint8_t> data;
+        std::shared_ptr<const std::vector<uint8_t>> sharedData;
+        //! Written in place of the first dataOffset bytes of the storage: the receiver specific headers of a shared
+        //! storage, or the compact headers of a simulation message
+        std::array<uint8_t, MaxSendingHeaderSize> header;
+        std::size_t headerSize{0};
+        std::size_t dataOffset{0};
+        bool isControlMsg{false};
+        bool isDroppable{false};
+
+        auto Storage() const -> const std::vector<uint8_t>& { return sharedData ? *sharedData : data; }
+        auto Size() const -> std::size_t { return headerSize + Storage().size() - dataOffset; }
+        auto NumBuffers() const -> std::size_t { return headerSize > 0 ? 2 : 1; }
+    };
+
+    //! Messages waiting to be written, the control lane is always written before the bulk lane
+    struct SendingQueue
+    {
+        std::deque<SendingBuffer> control;
+        std::deque<SendingBuffer> bulk;
+
+        bool empty() const { return control.empty() && bulk.empty(); }
+        auto front() -> SendingBuffer& { return control.empty() ? bulk.front() : control.front(); }
+        void pop_front()
+        {
+            auto& lane = control.empty() ? bulk : control;
+            lane.pop_front();
+        }
+        void push_back(SendingBuffer sendingBuffer)
+        {
+            auto& lane = sendingBuffer.isControlMsg ? control : bulk;
+            lane.push_back(std::move(sendingBuffer));
+        }
+        void clear()
+        {
+            control.clear();
+            bulk.clear();
+        }
+    };
+
+    //! The concurrent connects to the acceptor URIs of a peer, see ConnectAsync
+    struct ConnectAttempt;
 
 private:
     // ----------------------------------------
     // Private Methods
     static bool IsErrorToTryAgain(const asio::error_code & ec);
+    void RequestWrite();
+    void StartWrites();
+    void TakePendingSendingBuffers();
     void StartAsyncWrite();
     void WriteSomeAsync();
+    //! Return the number of bytes taken from the queue
+    auto TakeSendingBatch(SendingQueue& queue, std::vector<SendingBuffer>& batch) const -> std::size_t;
+    static void MakeSendingBuffers(const std::vector<SendingBuffer>& batch, std::vector<asio::const_buffer>& buffers);
+    static void ConsumeSendingBuffers(std::vector<asio::const_buffer>& buffers, std::size_t bytesWritten);
+    bool IsSendQueueFull() const;
+    //! Apply the overflow policy to a service message sent while the queue is full. Return false, if the message
+    //! must not be queued.
+    bool HandleSendQueueOverflow();
+    void DropOldestSendingBuffers(SendingQueue& queue);
+    //! Called whenever messages left the sending queue
+    void OnSendQueueDrained(std::size_t numMessages, std::size_t numBytes);
+    void WakeBlockedSenders();
+    void NotifySendQueueHighWaterMark(bool isAboveHighWaterMark);
+    //! Return false, if the held back messages exceeded the coalescing limit and were released with this one
+    bool HoldBackSendingBuffer(SendingBuffer sendingBuffer);
+    //! Move the held back messages to the pending queue, return false if there were none
+    bool ReleaseHeldSendingBuffers();
+    void MoveHeldSendingBuffersToPending();
     void ReadSomeAsync();
     void DispatchBuffer();
+    void DispatchMessage(std::vector<uint8_t> messageData);
+    bool IsValidMessageSize(uint32_t messageSize);
+    void PrepareReceiveBuffer();
+    void SendSharedMemoryMessage(SharedMemoryMessageKind kind, std::string segmentName = {});
+    void OnSharedMemoryMessage(const SharedMemoryMessage& message);
+    void AcceptSharedMemory(const std::string& segmentName);
+    void StartSharedMemoryWrite();
+    void WriteSharedMemory();
+    void ReadSharedMemory();
+    bool ReadSharedMemoryMessage();
     void Shutdown();
     bool ConnectLocal(const std::string& path);
     bool ConnectTcp(const std::string& host, uint16_t port);
+    void StartConnectAttempt(const std::shared_ptr<ConnectAttempt>& attempt);
+    void CompleteConnectAttempt(const std::shared_ptr<ConnectAttempt>& attempt);
+    void SetTcpSocketOptions();
 
 private:
     // ----------------------------------------
@@ -131,16 +271,67 @@ private:
     std::atomic<uint32_t> _currentMsgSize{0u};
     std::vector<uint8_t> _msgBuffer;
     size_t _wPos{0};
+    size_t _rPos{0};
+    ReceiveBufferPool _receiveBufferPool;
+    std::atomic<uint64_t> _numReceivedMessages{0};
+    std::atomic<uint64_t> _numReceivedBytes{0};
 
     // sending
     std::atomic_bool _isShuttingDown{false};
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    asio::mutable_buffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
-    mutable std::mutex _sendingQueueLock;
+    // messages pushed by the sending threads, moved to the socket or shared memory queue on the IO thread
+    MpscQueue<SendingBuffer> _pendingSendingBuffers;
+    std::atomic_bool _writeRequested{false};
+    std::atomic<std::size_t> _numQueuedMessages{0};
+    std::atomic<std::size_t> _numQueuedBytes{0};
+    SendingQueue _sendingQueue;
+    std::vector<asio::const_buffer> _currentSendingBuffers;
+    std::vector<SendingBuffer> _currentSendingBufferData;
     std::atomic_bool _sending{false};
+    std::size_t _batchedWriteMaxBytes{0};
+    std::size_t _batchedWriteMaxBuffers{1};
+    // simulation messages held back while the connection is coalescing a simulation step
+    bool _enableMessageCoalescing{false};
+    bool _prioritizeControlMessages{false};
+    std::size_t _messageCoalescingMaxBytes{0};
+    // kept apart from the pending messages, which every write started in the meantime would pick up
+    std::mutex _heldSendingBuffersMutex;
+    std::vector<SendingBuffer> _heldSendingBuffers;
+    std::atomic<std::size_t> _heldBytes{0};
+    std::atomic<uint64_t> _numWrites{0};
+    std::atomic<uint64_t> _numWrittenBuffers{0};
+    // traffic counters of the socket and the shared memory transport, see GetPeerStatistics
+    std::atomic<uint64_t> _numSentMessages{0};
+    std::atomic<uint64_t> _numSentBytes{0};
+    std::atomic<uint64_t> _maxQueuedMessages{0};
+    std::atomic<uint64_t> _maxQueuedBytes{0};
     bool _enableQuickAck{false};
+    // the peer reads simulation messages with compact network headers, see VAsioSerdes_CompactHeader.hpp
+    std::atomic_bool _useCompactHeaders{false};
+    // limits of the sending queue, only applied to the messages of services, zero if unbounded
+    std::size_t _sendQueueMaxBytes{0};
+    std::size_t _sendQueueMaxMessages{0};
+    Config::Middleware::SendQueueOverflowPolicy _sendQueueOverflowPolicy{
+        Config::Middleware::SendQueueOverflowPolicy::Block};
+    std::atomic<uint64_t> _numDroppedMessages{0};
+    std::atomic_bool _isAboveHighWaterMark{false};
+    // senders blocked by a full sending queue, woken up by the IO thread
+    std::mutex _sendQueueMutex;
+    std::condition_variable _sendQueueSpaceAvailable;
+    std::atomic<int> _numBlockedSenders{0};
+
+    // shared memory transport, sending via the socket queue until _sharedMemoryActive is set
+    std::unique_ptr<SharedMemoryChannel> _sharedMemoryChannel;
+    std::atomic_bool _sharedMemoryActive{false};
+    SendingQueue _sharedMemorySendingQueue;
+    std::vector<asio::const_buffer> _currentSharedMemoryBuffers;
+    std::vector<SendingBuffer> _currentSharedMemoryBufferData;
+    std::atomic_bool _sharedMemorySending{false};
+    std::array<uint8_t, sizeof(uint32_t)> _sharedMemoryMsgHeader{};
+    std::vector<uint8_t> _sharedMemoryMsgBuffer;
+    uint32_t _sharedMemoryMsgSize{0u};
+    size_t _sharedMemoryMsgPos{0u};
     Core::ServiceDescriptor _serviceDescriptor;
+    RemoteServiceEndpointCache _remoteServiceEndpoints;
 };
 
 // ================================================================================
@@ -150,11 +341,16 @@ private:
 void VAsioTcpPeer::SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor)
 {
     _serviceDescriptor = serviceDescriptor;
+    _remoteServiceEndpoints.Clear();
 }
 auto VAsioTcpPeer::GetServiceDescriptor() const -> const Core::ServiceDescriptor&
 {
     return _serviceDescriptor;
 }
+auto VAsioTcpPeer::GetRemoteServiceEndpoint(EndpointId endpointId) -> std::shared_ptr<const RemoteServiceEndpoint>
+{
+    return _remoteServiceEndpoints.Get(_serviceDescriptor, endpointId);
+}
 
 void VAsioTcpPeer::SetProtocolVersion(ProtocolVersion v)
 {
@@ -68,6 +68,9 @@ template<typename MsgT> struct MessageHistory<MsgT, 1>
             return;
 
         auto buffer = SerializedMessage(_last, _from, remoteIdx);
+        buffer.SetIsControlMsg(SilKitMsgTraits<MsgT>::IsControlMsg());
+        buffer.SetIsBroadcastMsg(SilKitMsgTraits<MsgT>::IsBroadcastMsg());
+        buffer.SetIsDroppableMsg(SilKitMsgTraits<MsgT>::IsDroppableMsg());
         peer->SendSilKitMsg(std::move(buffer));
     }
 private:
@@ -152,6 +155,9 @@ public:
             throw SilKitError{ss.str()};
         }
         auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiverIter->remoteIdx);
+        buffer.SetIsControlMsg(SilKitMsgTraits<MsgT>::IsControlMsg());
+        buffer.SetIsBroadcastMsg(SilKitMsgTraits<MsgT>::IsBroadcastMsg());
+        buffer.SetIsDroppableMsg(SilKitMsgTraits<MsgT>::IsDroppableMsg());
         receiverIter->peer->SendSilKitMsg(std::move(buffer));
     }
 
@@ -166,9 +172,33 @@ public:
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
-        for (auto& receiver : _remoteReceivers)
+
+        if (_remoteReceivers.size() == 1)
         {
+            auto&& receiver = _remoteReceivers.front();
             auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
+            buffer.SetIsControlMsg(SilKitMsgTraits<MsgT>::IsControlMsg());
+            buffer.SetIsBroadcastMsg(SilKitMsgTraits<MsgT>::IsBroadcastMsg());
+            buffer.SetIsDroppableMsg(SilKitMsgTraits<MsgT>::IsDroppableMsg());
+            receiver.peer->SendSilKitMsg(std::move(buffer));
+            return;
+        }
+
+        if (_remoteReceivers.empty())
+        {
+            return;
+        }
+
+        // Serialize the message only once. The receivers only differ in the remote index, which is part of the
+        // network headers and applied by each SerializedMessage referencing the shared storage.
+        auto sharedStorage =
+            SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), 0).ReleaseSharedStorage();
+        for (auto& receiver : _remoteReceivers)
+        {
+            SerializedMessage buffer{sharedStorage, receiver.remoteIdx};
+            buffer.SetIsControlMsg(SilKitMsgTraits<MsgT>::IsControlMsg());
+            buffer.SetIsBroadcastMsg(SilKitMsgTraits<MsgT>::IsBroadcastMsg());
+            buffer.SetIsDroppableMsg(SilKitMsgTraits<MsgT>::IsDroppableMsg());
             receiver.peer->SendSilKitMsg(std::move(buffer));
         }
     }
@@ -42,6 +42,47 @@ auto CreateSystemControllerImpl(IParticipant* participant)
     return participantInternal->GetSystemController();
 }
 
+void BeginServiceRegistrationBatchImpl(IParticipant* participant)
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    participantInternal->BeginServiceRegistrationBatch();
+}
+
+void EndServiceRegistrationBatchImpl(IParticipant* participant)
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    participantInternal->EndServiceRegistrationBatch();
+}
+
+void SetSendQueueHighWaterMarkHandlerImpl(IParticipant* participant,
+                                          std::function<void(const SendQueueHighWaterMarkEvent&)> handler)
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    participantInternal->SetSendQueueHighWaterMarkHandler(std::move(handler));
+}
+
+auto GetTrafficStatisticsImpl(IParticipant* participant) -> TrafficStatistics
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+    return participantInternal->GetTrafficStatistics();
+}
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
@@ -26,6 +26,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 //             nor public), as it is used to implement the 'legacy' ABI functions.
 // ================================================================================
 
+#include <functional>
+
 
 // Forward Declarations
 
@@ -43,6 +45,15 @@ class ISystemController;
 } // namespace Experimental
 } // namespace SilKit
 
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+struct SendQueueHighWaterMarkEvent;
+struct TrafficStatistics;
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
+
 
 // Function Declarations
 
@@ -53,6 +64,15 @@ namespace Participant {
 auto CreateSystemControllerImpl(IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+void BeginServiceRegistrationBatchImpl(IParticipant* participant);
+
+void EndServiceRegistrationBatchImpl(IParticipant* participant);
+
+void SetSendQueueHighWaterMarkHandlerImpl(IParticipant* participant,
+                                          std::function<void(const SendQueueHighWaterMarkEvent&)> handler);
+
+auto GetTrafficStatisticsImpl(IParticipant* participant) -> TrafficStatistics;
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "gtest/gtest.h"
 
 #include "silkit/participant/exception.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "NullConnectionParticipant.hpp"
 #include "ConfigurationTestUtils.hpp"
@@ -60,4 +61,21 @@ TEST_F(Test_ParticipantExtensionsImpl, error_on_create_system_controller_twice)
     EXPECT_THROW(SilKit::Experimental::Participant::CreateSystemControllerImpl(participant.get()), SilKit::SilKitError);
 }
 
+TEST_F(Test_ParticipantExtensionsImpl, error_on_service_registration_batch_with_invalid_participant)
+{
+    EXPECT_THROW(SilKit::Experimental::Participant::BeginServiceRegistrationBatchImpl(nullptr), SilKit::SilKitError);
+    EXPECT_THROW(SilKit::Experimental::Participant::EndServiceRegistrationBatchImpl(nullptr), SilKit::SilKitError);
+}
+
+TEST_F(Test_ParticipantExtensionsImpl, error_on_send_queue_high_water_mark_handler_with_invalid_participant)
+{
+    EXPECT_THROW(SilKit::Experimental::Participant::SetSendQueueHighWaterMarkHandlerImpl(nullptr, {}),
+                 SilKit::SilKitError);
+}
+
+TEST_F(Test_ParticipantExtensionsImpl, error_on_get_traffic_statistics_with_invalid_participant)
+{
+    EXPECT_THROW(SilKit::Experimental::Participant::GetTrafficStatisticsImpl(nullptr), SilKit::SilKitError);
+}
+
 } // anonymous namespace
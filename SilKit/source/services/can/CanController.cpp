@@ -88,7 +88,7 @@ auto CanController::IsRelevantNetwork(const Core::ServiceDescriptor& remoteServi
 {
     // NetSim uses ServiceType::Link and the simulated networkName
     return remoteServiceDescriptor.GetServiceType() == SilKit::Core::ServiceType::Link
-           && remoteServiceDescriptor.GetNetworkName() == _serviceDescriptor.GetNetworkName();
+           && remoteServiceDescriptor.GetInternedNetworkName() == _serviceDescriptor.GetInternedNetworkName();
 }
 
 auto CanController::AllowReception(const IServiceEndpoint* from) const -> bool
@@ -90,7 +90,7 @@ auto EthController::IsRelevantNetwork(const Core::ServiceDescriptor& remoteServi
 {
     // NetSim uses ServiceType::Link and the simulated networkName
     return remoteServiceDescriptor.GetServiceType() == SilKit::Core::ServiceType::Link
-           && remoteServiceDescriptor.GetNetworkName() == _serviceDescriptor.GetNetworkName();
+           && remoteServiceDescriptor.GetInternedNetworkName() == _serviceDescriptor.GetInternedNetworkName();
 }
 
 auto EthController::AllowReception(const IServiceEndpoint* from) const -> bool
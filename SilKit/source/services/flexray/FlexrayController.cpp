@@ -64,7 +64,7 @@ auto FlexrayController::AllowReception(const IServiceEndpoint* from) const -> bo
 {
     const auto& fromDescr = from->GetServiceDescriptor();
     return _simulatedLinkDetected &&
-           _simulatedLink.GetParticipantName() == fromDescr.GetParticipantName()
+           _simulatedLink.GetInternedParticipantName() == fromDescr.GetInternedParticipantName()
            && _serviceDescriptor.GetServiceId() == fromDescr.GetServiceId();
 }
 
@@ -72,7 +72,7 @@ auto FlexrayController::IsRelevantNetwork(const Core::ServiceDescriptor& remoteS
 {
     // NetSim uses ServiceType::Link and the simulated networkName
     return remoteServiceDescriptor.GetServiceType() == SilKit::Core::ServiceType::Link
-           && remoteServiceDescriptor.GetNetworkName() == _serviceDescriptor.GetNetworkName();
+           && remoteServiceDescriptor.GetInternedNetworkName() == _serviceDescriptor.GetInternedNetworkName();
 }
 
 // Expose for testing purposes
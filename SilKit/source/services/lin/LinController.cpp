@@ -96,7 +96,7 @@ auto LinController::AllowReception(const IServiceEndpoint* from) const -> bool
 auto LinController::IsRelevantNetwork(const Core::ServiceDescriptor& remoteServiceDescriptor) const -> bool
 {
     return remoteServiceDescriptor.GetServiceType() == SilKit::Core::ServiceType::Link
-           && remoteServiceDescriptor.GetNetworkName() == _serviceDescriptor.GetNetworkName();
+           && remoteServiceDescriptor.GetInternedNetworkName() == _serviceDescriptor.GetInternedNetworkName();
 }
 
 template <typename MsgT>
@@ -128,7 +128,7 @@ auto SimBehaviorDetailed::AllowReception(const Core::IServiceEndpoint* from) con
     // NetSim internally sets the ServiceId of this controller and sends messages with it,
     // this controller knows about NetSim through _simulatedLink.
     const auto& fromDescr = from->GetServiceDescriptor();
-    return _simulatedLink.GetParticipantName() == fromDescr.GetParticipantName()
+    return _simulatedLink.GetInternedParticipantName() == fromDescr.GetInternedParticipantName()
            && _parentServiceDescriptor->GetServiceId() == fromDescr.GetServiceId();
 }
 
@@ -356,7 +356,10 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
 
     _execTimeMonitor.StartMeasurement();
     _watchDog.Start();
+    // the messages sent by the step handler are written at once, when the handler returns
+    _participant->StartSendBuffering();
     _simTask(timePoint, duration);
+    _participant->FlushSendBuffers();
     _watchDog.Reset();
     _execTimeMonitor.StopMeasurement();
 
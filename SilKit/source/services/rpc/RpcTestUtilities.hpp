@@ -110,6 +110,7 @@ struct MockConnection
     }
 
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
+    void StartSendBuffering() {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
     void NotifyShutdown() {}
@@ -123,6 +124,15 @@ struct MockConnection
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> /*completionHandler*/){};
 
+    void BeginServiceRegistrationBatch() {}
+    void EndServiceRegistrationBatch() {}
+
+    void SetSendQueueHighWaterMarkHandler(
+        SilKit::Experimental::Participant::SendQueueHighWaterMarkHandler /*handler*/)
+    {
+    }
+    auto GetTrafficStatistics() -> SilKit::Experimental::Participant::TrafficStatistics { return {}; }
+
     void Test_SetTimeProvider(SilKit::Services::Orchestration::ITimeProvider* timeProvider)
     {
         for (auto& service : services.rpcClient)
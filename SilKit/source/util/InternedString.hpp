@@ -0,0 +1,239 @@
+/* Copyright (c) 2023 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "Hash.hpp"
+
+namespace SilKit {
+namespace Util {
+
+//! \brief Handle to a string stored once per process, e.g., the participant, network and service names.
+//!
+//! Equal strings are interned into the same entry, so that comparing handles is a pointer comparison. The hash of the
+//! string, see Hash::Hash, is computed once when it is interned. The entries are reference counted, and erased with
+//! their last handle, since services on networks with generated names come and go during the whole simulation.
+class InternedString
+{
+public:
+    // ----------------------------------------
+    // Constructors and Destructor
+
+    //! The empty string
+    inline InternedString();
+    inline explicit InternedString(const std::string& value);
+
+    inline InternedString(const InternedString& other);
+    inline InternedString(InternedString&& other) noexcept;
+    inline auto operator=(const InternedString& other) -> InternedString&;
+    inline auto operator=(InternedString&& other) noexcept -> InternedString&;
+    inline ~InternedString();
+
+public:
+    // ----------------------------------------
+    // Public Methods
+
+    auto Str() const -> const std::string& { return _entry->first; }
+    //! The platform independent hash of the string, see Hash::Hash
+    auto Hash() const -> uint64_t { return _entry->second.hash; }
+
+    bool operator==(const InternedString& other) const { return _entry == other._entry; }
+    bool operator!=(const InternedString& other) const { return _entry != other._entry; }
+
+    //! The number of distinct strings currently interned, including the empty string
+    static inline auto NumEntries() -> std::size_t;
+
+private:
+    // ----------------------------------------
+    // Private Data Types
+
+    struct EntryData
+    {
+        explicit EntryData(uint64_t hashValue)
+            : hash{hashValue}
+        {
+        }
+
+        uint64_t hash;
+        //! Changed through the const handles, the string and the hash never change
+        mutable std::atomic<std::size_t> refCount{0};
+    };
+
+    //! The nodes of the table are stable, so that the handles point directly to them
+    using Table = std::unordered_map<std::string, EntryData>;
+    using Entry = Table::value_type;
+
+    //! Allocated once and never destroyed, handles in static objects may outlive any static table
+    struct Registry
+    {
+        std::mutex mutex;
+        Table table;
+    };
+
+private:
+    // ----------------------------------------
+    // Private Methods
+    static inline auto GetRegistry() -> Registry&;
+    static inline auto Intern(const std::string& value) -> const Entry*;
+    static inline auto EmptyEntry() -> const Entry*;
+    static inline void AddRef(const Entry* entry);
+    static inline void Release(const Entry* entry);
+
+private:
+    // ----------------------------------------
+    // Private Members
+    const Entry* _entry;
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+InternedString::InternedString()
+    : _entry{EmptyEntry()}
+{
+    AddRef(_entry);
+}
+
+InternedString::InternedString(const std::string& value)
+    : _entry{Intern(value)}
+{
+}
+
+InternedString::InternedString(const InternedString& other)
+    : _entry{other._entry}
+{
+    AddRef(_entry);
+}
+
+InternedString::InternedString(InternedString&& other) noexcept
+    : _entry{other._entry}
+{
+    other._entry = EmptyEntry();
+    AddRef(other._entry);
+}
+
+auto InternedString::operator=(const InternedString& other) -> InternedString&
+{
+    AddRef(other._entry);
+    Release(_entry);
+    _entry = other._entry;
+    return *this;
+}
+
+auto InternedString::operator=(InternedString&& other) noexcept -> InternedString&
+{
+    std::swap(_entry, other._entry);
+    return *this;
+}
+
+InternedString::~InternedString()
+{
+    Release(_entry);
+}
+
+auto InternedString::NumEntries() -> std::size_t
+{
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    return registry.table.size();
+}
+
+auto InternedString::GetRegistry() -> Registry&
+{
+    static auto* registry = new Registry;
+    return *registry;
+}
+
+auto InternedString::Intern(const std::string& value) -> const Entry*
+{
+    auto& registry = GetRegistry();
+
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    auto it = registry.table.find(value);
+    if (it == registry.table.end())
+    {
+        it = registry.table
+                 .emplace(std::piecewise_construct, std::forward_as_tuple(value),
+                          std::forward_as_tuple(Hash::Hash(value)))
+                 .first;
+    }
+    // the last reference is only released under the lock, an entry found here is never about to be erased
+    it->second.refCount.fetch_add(1, std::memory_order_relaxed);
+    return &*it;
+}
+
+auto InternedString::EmptyEntry() -> const Entry*
+{
+    // holds a reference of its own, so that the empty string is never erased
+    static const Entry* emptyEntry = Intern(std::string{});
+    return emptyEntry;
+}
+
+void InternedString::AddRef(const Entry* entry)
+{
+    entry->second.refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void InternedString::Release(const Entry* entry)
+{
+    // Not the last reference, which is the common case of copied service descriptors
+    auto refCount = entry->second.refCount.load(std::memory_order_relaxed);
+    while (refCount > 1)
+    {
+        if (entry->second.refCount.compare_exchange_weak(refCount, refCount - 1, std::memory_order_release,
+                                                          std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    // Possibly the last reference, Intern may hand out a new one until the lock is taken
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    if (entry->second.refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        registry.table.erase(registry.table.find(entry->first));
+    }
+}
+
+} // namespace Util
+} // namespace SilKit
+
+namespace std {
+template <>
+struct hash<SilKit::Util::InternedString>
+{
+    auto operator()(const SilKit::Util::InternedString& value) const -> size_t
+    {
+        return static_cast<size_t>(value.Hash());
+    }
+};
+} // namespace std
@@ -0,0 +1,108 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "InternedString.hpp"
+
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using SilKit::Util::InternedString;
+
+TEST(UtilsInternedStringTest, equal_strings_share_their_entry)
+{
+    const std::string name{"CAN1"};
+    InternedString first{name};
+    InternedString second{std::string{"CAN"} + "1"};
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(&first.Str(), &second.Str());
+    EXPECT_EQ(first.Str(), name);
+    EXPECT_NE(first, InternedString{"CAN2"});
+}
+
+TEST(UtilsInternedStringTest, hash_matches_the_string_hash)
+{
+    InternedString name{"Participant1"};
+    EXPECT_EQ(name.Hash(), SilKit::Util::Hash::Hash("Participant1"));
+
+    std::unordered_set<InternedString> names{name, InternedString{"Participant1"}, InternedString{"Participant2"}};
+    EXPECT_EQ(names.size(), 2u);
+}
+
+TEST(UtilsInternedStringTest, default_constructed_is_the_empty_string)
+{
+    InternedString empty;
+    EXPECT_TRUE(empty.Str().empty());
+    EXPECT_EQ(empty, InternedString{std::string{}});
+    EXPECT_EQ(empty.Hash(), SilKit::Util::Hash::Hash(std::string{}));
+}
+
+TEST(UtilsInternedStringTest, entries_are_erased_with_their_last_handle)
+{
+    const std::string name{"Network-4f9c2d1e"};
+    const auto numEntries = InternedString::NumEntries();
+    {
+        InternedString first{name};
+        auto copy = first;
+        InternedString moved{std::move(copy)};
+        InternedString assigned;
+        assigned = moved;
+
+        EXPECT_EQ(assigned, first);
+        EXPECT_EQ(InternedString::NumEntries(), numEntries + 1);
+    }
+    EXPECT_EQ(InternedString::NumEntries(), numEntries);
+
+    InternedString again{name};
+    EXPECT_EQ(again.Str(), name);
+    EXPECT_EQ(InternedString::NumEntries(), numEntries + 1);
+}
+
+TEST(UtilsInternedStringTest, concurrent_handles_release_all_entries)
+{
+    const auto numEntries = InternedString::NumEntries();
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (auto i = 0; i < 1000; ++i)
+            {
+                InternedString name{"Network" + std::to_string(i % 10)};
+                auto copy = name;
+                EXPECT_EQ(copy, InternedString{name.Str()});
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(InternedString::NumEntries(), numEntries);
+}
+
+} // anonymous namespace
@@ -23,19 +23,32 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/util/Span.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <initializer_list>
 #include <memory>
 #include <algorithm>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
 
+//! Immutable elements, which are cheap to copy. Small payloads of trivially copyable elements (e.g., CAN FD frames
+//! and LIN payloads) are stored inline without allocating. Larger payloads are copied into a single allocation with
+//! an intrusive reference count, or reference the storage of another object.
 template <typename T>
 class SharedVector
 {
     static_assert(!std::is_const<T>::value, "T must not be const");
     static_assert(!std::is_reference<T>::value, "T must not be a reference");
 
+public:
+    //! Number of elements stored inside the object itself
+    static constexpr size_t InlineCapacity = std::is_trivially_copyable<T>::value ? 64 / sizeof(T) : 0;
+
 public:
     SharedVector() = default;
 
@@ -45,10 +58,40 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Reference elements owned by another object, e.g., the storage of a received message, without copying them.
+    //! The owner is kept alive by the aliasing shared pointer.
+    SharedVector(std::shared_ptr<const T> data, size_t size);
+
+    SharedVector(const SharedVector& other);
+    SharedVector(SharedVector&& other) noexcept;
+
+    ~SharedVector();
+
+    auto operator=(const SharedVector& other) -> SharedVector&;
+    auto operator=(SharedVector&& other) noexcept -> SharedVector&;
+
+    //! The span refers into this object for inline elements, it must not outlive it
     auto AsSpan() const& -> Span<const T>;
 
+    //! True if the elements are stored inside the object, without any allocation
+    auto IsInline() const -> bool;
+
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    //! The reference count, followed by the elements in the same allocation
+    struct Block;
+
+    void Assign(std::shared_ptr<std::vector<T>> vector);
+    void AssignInline(const Span<const T> span, size_t size, const T& padValue);
+    void AssignBlock(const Span<const T> span, size_t size, const T& padValue);
+    void MoveFrom(SharedVector& other) noexcept;
+    void Reset() noexcept;
+
+private:
+    std::shared_ptr<const T> _data;
+    Block* _block{nullptr};
+    size_t _size{0};
+    // only the first _size elements are initialized, if neither _data nor _block is set
+    std::array<T, InlineCapacity> _inline;
 };
 
 template <typename T>
@@ -58,31 +101,199 @@ bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs);
 //  Inline Implementations
 // ================================================================================
 
+template <typename T>
+constexpr size_t SharedVector<T>::InlineCapacity;
+
+template <typename T>
+struct SharedVector<T>::Block
+{
+    std::atomic<size_t> refCount{1};
+
+    static auto ElementsOffset() -> size_t { return (sizeof(Block) + alignof(T) - 1) / alignof(T) * alignof(T); }
+
+    static auto Create(size_t size) -> Block*
+    {
+        return new (::operator new(ElementsOffset() + size * sizeof(T))) Block{};
+    }
+
+    auto Elements() -> T* { return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(this) + ElementsOffset()); }
+
+    void AddRef() { refCount.fetch_add(1, std::memory_order_relaxed); }
+
+    void Release()
+    {
+        if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            this->~Block();
+            ::operator delete(this);
+        }
+    }
+};
+
 template <typename T>
 SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
-    : SharedVector(std::vector<T>{initializerList})
+    : SharedVector(Span<const T>{initializerList.begin(), initializerList.size()})
 {
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
-    : _data{std::make_shared<std::vector<T>>(std::move(vector))}
 {
+    if (vector.size() <= InlineCapacity)
+    {
+        AssignInline(vector, vector.size(), T{});
+    }
+    else
+    {
+        // the elements are already allocated, take them over instead of copying
+        Assign(std::make_shared<std::vector<T>>(std::move(vector)));
+    }
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    const auto size = (std::max)(span.size(), minimumSize);
+    if (size <= InlineCapacity)
+    {
+        AssignInline(span, size, padValue);
+    }
+    else if (std::is_trivially_copyable<T>::value)
+    {
+        AssignBlock(span, size, padValue);
+    }
+    else
+    {
+        auto vector = std::make_shared<std::vector<T>>(span.begin(), span.end());
+        vector->resize(size, padValue);
+        Assign(std::move(vector));
+    }
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const T> data, size_t size)
+    : _data{std::move(data)}
+    , _size{size}
+{
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(const SharedVector& other)
+    : _data{other._data}
+    , _block{other._block}
+    , _size{other._size}
+{
+    if (_block)
+    {
+        _block->AddRef();
+    }
+    else if (!_data)
+    {
+        std::copy_n(other._inline.data(), _size, _inline.data());
+    }
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(SharedVector&& other) noexcept
+{
+    MoveFrom(other);
+}
+
+template <typename T>
+SharedVector<T>::~SharedVector()
+{
+    Reset();
+}
+
+template <typename T>
+auto SharedVector<T>::operator=(const SharedVector& other) -> SharedVector&
+{
+    if (this != &other)
+    {
+        SharedVector copy{other};
+        Reset();
+        MoveFrom(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+auto SharedVector<T>::operator=(SharedVector&& other) noexcept -> SharedVector&
+{
+    if (this != &other)
+    {
+        Reset();
+        MoveFrom(other);
+    }
+    return *this;
+}
+
+template <typename T>
+void SharedVector<T>::Assign(std::shared_ptr<std::vector<T>> vector)
+{
+    _size = vector->size();
+    _data = std::shared_ptr<const T>{vector, vector->data()};
+}
+
+template <typename T>
+void SharedVector<T>::AssignInline(const Span<const T> span, size_t size, const T& padValue)
+{
+    std::copy(span.begin(), span.end(), _inline.data());
+    std::fill(_inline.data() + span.size(), _inline.data() + size, padValue);
+    _size = size;
+}
+
+template <typename T>
+void SharedVector<T>::AssignBlock(const Span<const T> span, size_t size, const T& padValue)
+{
+    _block = Block::Create(size);
+    auto* elements = _block->Elements();
+    std::copy(span.begin(), span.end(), elements);
+    std::fill(elements + span.size(), elements + size, padValue);
+    _size = size;
+}
+
+template <typename T>
+void SharedVector<T>::MoveFrom(SharedVector& other) noexcept
+{
+    _data = std::move(other._data);
+    _block = other._block;
+    _size = other._size;
+    if (!_block && !_data)
+    {
+        std::copy_n(other._inline.data(), _size, _inline.data());
+    }
+
+    other._block = nullptr;
+    other._size = 0;
+}
+
+template <typename T>
+void SharedVector<T>::Reset() noexcept
+{
+    if (_block)
+    {
+        _block->Release();
+        _block = nullptr;
+    }
+    _data.reset();
+    _size = 0;
 }
 
 template <typename T>
 auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
-    if (_data)
+    if (_block)
+    {
+        return {_block->Elements(), _size};
+    }
+    else if (_data)
     {
-        return {_data->data(), _data->size()};
+        return {_data.get(), _size};
+    }
+    else if (_size > 0)
+    {
+        return {_inline.data(), _size};
     }
     else
     {
@@ -90,6 +301,12 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
     }
 }
 
+template <typename T>
+auto SharedVector<T>::IsInline() const -> bool
+{
+    return !_block && !_data && _size > 0;
+}
+
 template <typename T>
 bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs)
 {
@@ -0,0 +1,146 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "SharedVector.hpp"
+
+namespace {
+
+using SilKit::Util::SharedVector;
+using SilKit::Util::Span;
+using SilKit::Util::ToSpan;
+
+auto MakeBytes(size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    return bytes;
+}
+
+TEST(Test_SharedVector, small_payloads_are_stored_inline)
+{
+    const auto bytes = MakeBytes(SharedVector<uint8_t>::InlineCapacity);
+
+    SharedVector<uint8_t> fromSpan{ToSpan(bytes)};
+    EXPECT_TRUE(fromSpan.IsInline());
+    EXPECT_TRUE(ItemsAreEqual(fromSpan.AsSpan(), ToSpan(bytes)));
+
+    SharedVector<uint8_t> fromVector{bytes};
+    EXPECT_TRUE(fromVector.IsInline());
+    EXPECT_TRUE(ItemsAreEqual(fromVector.AsSpan(), ToSpan(bytes)));
+
+    // a CAN FD frame and a LIN payload
+    EXPECT_GE(SharedVector<uint8_t>::InlineCapacity, 64u);
+    EXPECT_TRUE((SharedVector<uint8_t>{1, 2, 3, 4, 5, 6, 7, 8}.IsInline()));
+}
+
+TEST(Test_SharedVector, large_payloads_are_shared_between_copies)
+{
+    const auto bytes = MakeBytes(SharedVector<uint8_t>::InlineCapacity + 1);
+
+    SharedVector<uint8_t> original{ToSpan(bytes)};
+    EXPECT_FALSE(original.IsInline());
+
+    SharedVector<uint8_t> copy{original};
+    EXPECT_EQ(copy.AsSpan().data(), original.AsSpan().data());
+
+    SharedVector<uint8_t> assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.AsSpan().data(), original.AsSpan().data());
+
+    // the elements stay alive as long as any copy references them
+    original = SharedVector<uint8_t>{};
+    copy = SharedVector<uint8_t>{};
+    EXPECT_TRUE(ItemsAreEqual(assigned.AsSpan(), ToSpan(bytes)));
+}
+
+TEST(Test_SharedVector, copies_of_inline_payloads_refer_to_their_own_elements)
+{
+    const auto bytes = MakeBytes(8);
+
+    SharedVector<uint8_t> original{ToSpan(bytes)};
+    SharedVector<uint8_t> copy{original};
+    EXPECT_NE(copy.AsSpan().data(), original.AsSpan().data());
+    EXPECT_TRUE(ItemsAreEqual(copy.AsSpan(), ToSpan(bytes)));
+
+    SharedVector<uint8_t> moved{std::move(original)};
+    EXPECT_TRUE(ItemsAreEqual(moved.AsSpan(), ToSpan(bytes)));
+    EXPECT_EQ(original.AsSpan().size(), 0u);
+
+    SharedVector<uint8_t> moveAssigned;
+    moveAssigned = std::move(moved);
+    EXPECT_TRUE(ItemsAreEqual(moveAssigned.AsSpan(), ToSpan(bytes)));
+    EXPECT_EQ(moved.AsSpan().size(), 0u);
+}
+
+TEST(Test_SharedVector, padding_applies_to_inline_and_allocated_payloads)
+{
+    const auto bytes = MakeBytes(4);
+
+    SharedVector<uint8_t> inlinePadded{ToSpan(bytes), 60, 0xff};
+    EXPECT_TRUE(inlinePadded.IsInline());
+    ASSERT_EQ(inlinePadded.AsSpan().size(), 60u);
+    EXPECT_EQ(inlinePadded.AsSpan()[3], 3);
+    EXPECT_EQ(inlinePadded.AsSpan()[59], 0xff);
+
+    SharedVector<uint8_t> allocatedPadded{ToSpan(bytes), 100, 0xff};
+    EXPECT_FALSE(allocatedPadded.IsInline());
+    ASSERT_EQ(allocatedPadded.AsSpan().size(), 100u);
+    EXPECT_EQ(allocatedPadded.AsSpan()[3], 3);
+    EXPECT_EQ(allocatedPadded.AsSpan()[99], 0xff);
+}
+
+TEST(Test_SharedVector, referenced_elements_keep_their_owner_alive)
+{
+    auto owner = std::make_shared<std::vector<uint8_t>>(MakeBytes(16));
+    SharedVector<uint8_t> view{std::shared_ptr<const uint8_t>{owner, owner->data() + 8}, 8};
+    EXPECT_FALSE(view.IsInline());
+    EXPECT_EQ(owner.use_count(), 2);
+
+    const auto* data = owner->data();
+    owner.reset();
+    EXPECT_EQ(view.AsSpan().data(), data + 8);
+    EXPECT_EQ(view.AsSpan()[0], 8);
+}
+
+TEST(Test_SharedVector, elements_which_are_not_trivially_copyable_are_never_inline)
+{
+    EXPECT_EQ(SharedVector<std::string>::InlineCapacity, 0u);
+
+    SharedVector<std::string> strings{std::vector<std::string>{"a", "b"}};
+    EXPECT_FALSE(strings.IsInline());
+    ASSERT_EQ(strings.AsSpan().size(), 2u);
+    EXPECT_EQ(strings.AsSpan()[1], "b");
+
+    SharedVector<std::string> copy{strings};
+    EXPECT_EQ(copy.AsSpan().data(), strings.AsSpan().data());
+}
+
+} // namespace